@@ -0,0 +1,106 @@
+// 浹 ε ġũ
+//    (sqrt)   + Ÿ   Ѵ.
+// : cl bench_broadphase.cpp /O2 /EHsc /std:c++17
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include "broadphase.h"
+
+const float GAME_LEFT = -1.0f;
+const float GAME_RIGHT = 1.0f;
+const float GAME_BOTTOM = -1.0f;
+const float GAME_TOP = 1.0f;
+
+const float BULLET_SIZE = 0.015f;
+const float TARGET_SIZE = 0.08f;
+const float CELL_SIZE = 0.125f;
+const int TARGET_COUNT = 64;
+const int REPEATS = 20;
+
+struct Points {
+    std::vector<float> x, y;
+};
+
+Points randomPoints(int count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(GAME_LEFT, GAME_RIGHT);
+    Points p;
+    for (int i = 0; i < count; i++) {
+        p.x.push_back(dist(rng));
+        p.y.push_back(dist(rng));
+    }
+    return p;
+}
+
+//  Game::update :  ֿ  sqrt Ÿ 
+long long bruteForce(const Points& bullets, const Points& targets) {
+    long long hits = 0;
+    float radius = (BULLET_SIZE + TARGET_SIZE) * 0.8f;
+    for (size_t t = 0; t < targets.x.size(); t++) {
+        for (size_t i = 0; i < bullets.x.size(); i++) {
+            float dx = bullets.x[i] - targets.x[t];
+            float dy = bullets.y[i] - targets.y[t];
+            if (sqrt(dx * dx + dy * dy) < radius) hits++;
+        }
+    }
+    return hits;
+}
+
+// ڸ    Ÿٸ ֺ  ˻
+long long gridBased(UniformGrid& grid, const Points& bullets, const Points& targets) {
+    long long hits = 0;
+    float radius = (BULLET_SIZE + TARGET_SIZE) * 0.8f;
+    grid.build((int)bullets.x.size(), [&](int i, float& x, float& y) {
+        x = bullets.x[i];
+        y = bullets.y[i];
+    });
+    for (size_t t = 0; t < targets.x.size(); t++) {
+        grid.query(targets.x[t], targets.y[t], radius, [&](int i) {
+            if (circlesOverlap(bullets.x[i], bullets.y[i], targets.x[t], targets.y[t], radius)) hits++;
+        });
+    }
+    return hits;
+}
+
+template <typename F>
+double measureMs(F f, long long& result) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; r++) {
+        result = f();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / REPEATS;
+}
+
+int main() {
+    std::mt19937 rng(451);
+    Points targets = randomPoints(TARGET_COUNT, rng);
+    UniformGrid grid(GAME_LEFT, GAME_BOTTOM, GAME_RIGHT, GAME_TOP, CELL_SIZE);
+
+    std::cout << "targets: " << TARGET_COUNT << ", cell: " << CELL_SIZE << std::endl;
+    std::cout << std::setw(10) << "bullets" << std::setw(14) << "brute (ms)"
+        << std::setw(14) << "grid (ms)" << std::setw(10) << "speedup" << std::setw(10) << "hits" << std::endl;
+
+    const int counts[] = { 1000, 10000, 100000 };
+    for (int count : counts) {
+        Points bullets = randomPoints(count, rng);
+
+        long long bruteHits = 0, gridHits = 0;
+        double bruteMs = measureMs([&] { return bruteForce(bullets, targets); }, bruteHits);
+        double gridMs = measureMs([&] { return gridBased(grid, bullets, targets); }, gridHits);
+
+        std::cout << std::setw(10) << count
+            << std::setw(14) << std::fixed << std::setprecision(3) << bruteMs
+            << std::setw(14) << gridMs
+            << std::setw(9) << std::setprecision(1) << bruteMs / gridMs << "x"
+            << std::setw(10) << gridHits << std::endl;
+
+        if (bruteHits != gridHits) {
+            std::cerr << "hit count mismatch: " << bruteHits << " vs " << gridHits << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
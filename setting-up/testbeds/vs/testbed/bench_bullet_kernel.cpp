@@ -0,0 +1,70 @@
+// Ѿ /  Ŀ ũκġũ
+// Į ο   õ SIMD  ó(Ѿ/ns) Ѵ.
+// : cl bench_bullet_kernel.cpp /O2 /EHsc /std:c++17 /arch:AVX2 /I ..\include
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "bullet_kernel.h"
+
+const int BULLET_COUNT = 100000;
+const int ITERATIONS = 2000;
+const float DELTA_TIME = 1.0f / 120.0f;
+
+struct Bullets {
+    std::vector<float> px, py, vx, vy;
+    std::vector<unsigned char> active;
+};
+
+Bullets makeBullets(int count) {
+    std::mt19937 rng(451);
+    std::uniform_real_distribution<float> pos(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> vel(-1.2f, 1.2f);
+    Bullets b;
+    for (int i = 0; i < count; i++) {
+        b.px.push_back(pos(rng));
+        b.py.push_back(pos(rng));
+        b.vx.push_back(vel(rng));
+        b.vy.push_back(vel(rng));
+    }
+    b.active.assign(count, 1);
+    return b;
+}
+
+template <typename Kernel>
+double bulletsPerNs(Kernel kernel, Bullets& b, const BulletBounds& bounds) {
+    int count = (int)b.px.size();
+    auto start = std::chrono::steady_clock::now();
+    for (int it = 0; it < ITERATIONS; it++) {
+        // Ź ڷ ǵ Ѿ  ó ӹ Ѵ
+        float dt = (it & 1) ? -DELTA_TIME : DELTA_TIME;
+        kernel(b.px.data(), b.py.data(), b.vx.data(), b.vy.data(), b.active.data(), count, dt, bounds);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return (double)count * ITERATIONS / ns;
+}
+
+int main() {
+    BulletBounds bounds = { -1.015f, -1.015f, 1.015f, 1.015f };
+
+    Bullets scalar = makeBullets(BULLET_COUNT);
+    Bullets simd = makeBullets(BULLET_COUNT);
+
+    double scalarRate = bulletsPerNs(integrateBulletsScalar, scalar, bounds);
+    double simdRate = bulletsPerNs(integrateBullets, simd, bounds);
+
+    int mismatches = 0;
+    for (int i = 0; i < BULLET_COUNT; i++) {
+        if (scalar.active[i] != simd.active[i]) mismatches++;
+    }
+
+    std::cout << "bullets: " << BULLET_COUNT << ", iterations: " << ITERATIONS << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(16) << "scalar" << std::setw(10) << scalarRate << " bullets/ns" << std::endl;
+    std::cout << std::setw(16) << bulletKernelName() << std::setw(10) << simdRate << " bullets/ns"
+        << "  (" << std::setprecision(1) << simdRate / scalarRate << "x)" << std::endl;
+    std::cout << "active mask mismatches: " << mismatches << std::endl;
+    return 0;
+}
@@ -0,0 +1,258 @@
+// â  ׸   ġũ
+// EGL surfaceless ؽƮ(Mesa llvmpipe ) FBO ٿ, ȭ Game ¸ M  ׸
+// Ӵ ο / /ð ӹ üũ Ѵ.
+// GPU ÷̰  CI ӽſ ׸  ȭ ȸ͸   .
+// : g++ bench_render.cpp -O2 -std=c++17 -I../include -lEGL -lGLEW -lGL -pthread -o bench_render
+//
+// : bench_render [--bullets N] [--particles N] [--frames M] [--core] [--ticks N] [--seed N]
+//                     [--script ] [--patterns ] [--size WxH] [--expect üũ] [--save .ppm]
+//   --ticks/--seed/--script/--patterns  headless  .  ŭ ùķ̼ ¸ ׸
+//   --bullets N   ׸   Ѿ N ä
+//   --particles N ׸  ǰ Ҳ N Ѹ (⺻ 0)
+//   --core        3.3 ھ  + CoreRenderer ( ȣȯ  + LegacyRenderer)
+//   --expect      üũ ٸ  ڵ 1 (CI ȸ Ȯο)
+//   --save          PPM  
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include "game.h"
+#include "game_render.h"
+#include "script.h"
+
+struct BenchConfig {
+    int bullets = 10000;
+    int particles = 0;
+    int frames = 200;
+    bool core = false;
+    int ticks = 600;
+    unsigned int seed = 0;
+    int width = 800;
+    int height = 600;
+    std::string scriptPath;
+    std::string patternPath;
+    std::string expect;
+    std::string savePath;
+};
+
+// ȭ ü ڷ  Ѿ target  ä ( ¶    ׸)
+void fillBullets(Game& game, int target) {
+    int serial = 0;
+    while (game.bullets.count < target) {
+        int i = serial++;
+        float x = GAME_LEFT + 0.05f + (i % 97) * 0.0196f;
+        float y = GAME_BOTTOM + 0.05f + (i / 97 % 89) * 0.0213f;
+        game.spawnBullet(Vec2(x, y), Vec2((i % 5 - 2) * 0.1f, (i % 3 - 1) * 0.1f));
+    }
+}
+
+// ȭ  Ҳ Ͷ߷ target  ä (update  Ƿ    ׸)
+void fillParticles(Game& game, int target) {
+    int serial = 0;
+    while (game.particles.size() < target) {
+        int i = serial++;
+        float x = GAME_LEFT + 0.1f + (i % 19) * 0.1f;
+        float y = GAME_BOTTOM + 0.1f + (i / 19 % 19) * 0.1f;
+        int n = std::min(HIT_SPARKS, target - game.particles.size());
+        game.particles.burst(x, y, n, i % PARTICLE_KIND_COUNT, game.rng[RANDOM_PARTICLES]);
+    }
+}
+
+// EGL surfaceless ؽƮ (â pbuffer   FBO  ׸)
+bool createContext(bool core, EGLDisplay& display) {
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    display = getPlatformDisplay
+        ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr)
+        : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        std::cerr << "EGL ʱȭ " << std::endl;
+        return false;
+    }
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        std::cerr << "EGL  ũ OpenGL    ϴ" << std::endl;
+        return false;
+    }
+
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    eglChooseConfig(display, configAttribs, &config, 1, &configCount);
+
+    const EGLint coreAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+    const EGLint compatAttribs[] = {
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT, EGL_NONE };
+    // surfaceless   ̵ ؽƮ   ִ (EGL_KHR_no_config_context)
+    EGLContext context = eglCreateContext(display, configCount > 0 ? config : (EGLConfig)0, EGL_NO_CONTEXT,
+        core ? coreAttribs : compatAttribs);
+    if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        std::cerr << "EGL ؽƮ   (" << (core ? "core 3.3" : "compatibility") << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// FNV-1a
+uint64_t checksum(const std::vector<unsigned char>& pixels) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : pixels) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+void savePPM(const std::string& path, const std::vector<unsigned char>& pixels, int width, int height) {
+    std::ofstream file(path, std::ios::binary);
+    file << "P6 " << width << " " << height << " 255\n";
+    for (int y = height - 1; y >= 0; y--) { // GL Ʒ ٺ
+        for (int x = 0; x < width; x++) {
+            file.write((const char*)&pixels[(y * width + x) * 4], 3);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--bullets" && hasValue) config.bullets = std::min(MAX_BULLETS, std::max(0, std::atoi(argv[++i])));
+        else if (arg == "--particles" && hasValue) config.particles = std::min(MAX_PARTICLES, std::max(0, std::atoi(argv[++i])));
+        else if (arg == "--frames" && hasValue) config.frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--core") config.core = true;
+        else if (arg == "--ticks" && hasValue) config.ticks = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--seed" && hasValue) config.seed = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--script" && hasValue) config.scriptPath = argv[++i];
+        else if (arg == "--patterns" && hasValue) config.patternPath = argv[++i];
+        else if (arg == "--size" && hasValue && std::sscanf(argv[++i], "%dx%d", &config.width, &config.height) == 2) {}
+        else if (arg == "--expect" && hasValue) config.expect = argv[++i];
+        else if (arg == "--save" && hasValue) config.savePath = argv[++i];
+        else {
+            std::cerr << ": " << argv[0]
+                << " [--bullets N] [--particles N] [--frames M] [--core] [--ticks N] [--seed N] [--script ] [--patterns ]"
+                << " [--size WxH] [--expect üũ] [--save .ppm]" << std::endl;
+            return 2;
+        }
+    }
+
+    // ׸  ȭ: headless    ùķ̼  Ѿ ä
+    std::vector<ScriptEntry> script;
+    if (!config.scriptPath.empty() && !loadScript(config.scriptPath, script)) {
+        std::cerr << "ũƮ   ϴ: " << config.scriptPath << std::endl;
+        return 1;
+    }
+    std::vector<PatternDef> patterns = defaultPatterns();
+    std::string error;
+    if (!config.patternPath.empty() && !loadPatterns(config.patternPath, patterns, error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    Game game(config.seed);
+    game.setPatterns(patterns);
+    size_t next = 0;
+    unsigned int input = 0;
+    for (int tick = 0; tick < config.ticks; tick++) {
+        while (next < script.size() && script[next].tick <= tick) {
+            input = script[next++].input;
+        }
+        game.handleInput(input);
+        game.update(SIM_DT);
+    }
+    fillBullets(game, config.bullets);
+    fillParticles(game, config.particles);
+
+    // GL غ
+    EGLDisplay display;
+    if (!createContext(config.core, display)) return 1;
+
+    glewExperimental = GL_TRUE;
+    GLenum glewResult = glewInit();
+    // GLX   GLEW  X ÷̰ ٰ  GL Լ ̹ о
+    if (glewResult != GLEW_OK && glewResult != GLEW_ERROR_NO_GLX_DISPLAY) {
+        std::cerr << "GLEW ʱȭ : " << glewGetErrorString(glewResult) << std::endl;
+        return 1;
+    }
+    glGetError();
+
+    GLuint fbo, colorBuffer;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &colorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, config.width, config.height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "FBO  " << std::endl;
+        return 1;
+    }
+
+    // assn1.cpp  main   
+    glClearColor(0.05f, 0.05f, 0.1f, 1.0f);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    if (config.core) renderer = &coreRenderer;
+    initVBOs();
+    if (!renderer->init(renderMeshes())) {
+        std::cerr << renderer->name() << "  ʱȭ " << std::endl;
+        return 1;
+    }
+    renderer->resize(config.width, config.height);
+
+    // ù  ̴/ غ ̹Ƿ  ʴ´
+    game.render(0.5f);
+    glFinish();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < config.frames; frame++) {
+        frameArena.reset();
+        game.render(0.5f);
+    }
+    glFinish();
+    auto end = std::chrono::steady_clock::now();
+    double msPerFrame = std::chrono::duration<double, std::milli>(end - start).count() / config.frames;
+    RenderStats stats = renderer->frameStats();
+
+    std::vector<unsigned char> pixels((size_t)config.width * config.height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, config.width, config.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    GLenum glError = glGetError();
+
+    char hash[32];
+    std::snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)checksum(pixels));
+    std::cout << "renderer: " << renderer->name() << " (" << glGetString(GL_RENDERER) << ")" << std::endl;
+    std::cout << "bullets: " << game.bullets.count << ", particles: " << game.particles.aliveCount() << ", frames: " << config.frames
+        << ", size: " << config.width << "x" << config.height << std::endl;
+    std::cout << "draw calls/frame: " << stats.drawCalls << ", instances/frame: " << stats.instances
+        << ", vertices/frame: " << stats.vertices << std::endl;
+    std::cout << "ms/frame: " << msPerFrame << std::endl;
+    std::cout << "checksum: " << hash << std::endl;
+
+    if (!config.savePath.empty()) savePPM(config.savePath, pixels, config.width, config.height);
+
+    cleanupVBOs();
+    glDeleteRenderbuffers(1, &colorBuffer);
+    glDeleteFramebuffers(1, &fbo);
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglTerminate(display);
+
+    if (glError != GL_NO_ERROR) {
+        std::cerr << "GL : 0x" << std::hex << glError << std::endl;
+        return 1;
+    }
+    if (!config.expect.empty() && config.expect != hash) {
+        std::cerr << "üũ ٸϴ: 밪 " << config.expect << std::endl;
+        return 1;
+    }
+    return 0;
+}
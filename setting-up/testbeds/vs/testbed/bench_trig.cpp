@@ -0,0 +1,98 @@
+// ﰢԼ   ġũ
+// std / glm ׽ / ǥ  ִ , ƼƼ     з ﰢԼ  .
+//  ƼƼ Ӹ atan2   + sin/cos   (  ȸ) θٰ .
+// : cl bench_trig.cpp /O2 /EHsc /std:c++17 /I ..\include
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include "fast_trig.h"
+
+const int ENTITY_COUNT = 100000;
+const int FRAMES = 200;
+
+struct TrigImpl {
+    const char* name;
+    float (*sinFn)(float);
+    float (*cosFn)(float);
+    float (*atan2Fn)(float, float);
+};
+
+float stdSin(float x) { return std::sin(x); }
+float stdCos(float x) { return std::cos(x); }
+float stdAtan2(float y, float x) { return std::atan2(y, x); }
+
+//  ϳ: ƼƼ ǥ   ϰ   ͸ 
+template <typename Sin, typename Cos, typename Atan2>
+float frameWork(const std::vector<float>& dx, const std::vector<float>& dy, float offset,
+    Sin sinFn, Cos cosFn, Atan2 atan2Fn) {
+    float sum = 0;
+    for (size_t i = 0; i < dx.size(); i++) {
+        float angle = atan2Fn(dy[i], dx[i]) + offset;
+        sum += cosFn(angle) * 0.5f + sinFn(angle) * 0.25f;
+    }
+    return sum;
+}
+
+double msPerFrame(const TrigImpl& impl, const std::vector<float>& dx, const std::vector<float>& dy, float& sink) {
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; f++) {
+        sink += frameWork(dx, dy, f * 0.01f, impl.sinFn, impl.cosFn, impl.atan2Fn);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / FRAMES;
+}
+
+void measureError(const TrigImpl& impl, double& sinErr, double& cosErr, double& atanErr) {
+    sinErr = cosErr = atanErr = 0;
+    for (int i = -200000; i <= 200000; i++) {
+        float x = i * (glm::two_pi<float>() / 200000); // [-2, 2]
+        sinErr = std::max(sinErr, std::abs((double)impl.sinFn(x) - std::sin((double)x)));
+        cosErr = std::max(cosErr, std::abs((double)impl.cosFn(x) - std::cos((double)x)));
+    }
+    for (int i = 0; i < 100000; i++) {
+        double a = -3.14159265358979 + i * (2 * 3.14159265358979 / 100000);
+        double r = 0.01 + (i % 7) * 0.5;
+        float y = (float)(std::sin(a) * r), x = (float)(std::cos(a) * r);
+        double diff = std::abs((double)impl.atan2Fn(y, x) - std::atan2((double)y, (double)x));
+        atanErr = std::max(atanErr, std::min(diff, 2 * 3.14159265358979 - diff));
+    }
+}
+
+int main() {
+    std::mt19937 rng(451);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> dx(ENTITY_COUNT), dy(ENTITY_COUNT);
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        dx[i] = dist(rng);
+        dy[i] = dist(rng);
+    }
+
+    TrigImpl impls[] = {
+        { "std", stdSin, stdCos, stdAtan2 },
+        { "poly (glm)", sinPoly, cosPoly, atan2Poly },
+        { "table", sinTableLookup, cosTableLookup, atan2Poly },
+    };
+
+    std::cout << "entities: " << ENTITY_COUNT << ", frames: " << FRAMES
+        << ", game build uses: " << trigModeName() << std::endl;
+    std::cout << std::setw(12) << "impl" << std::setw(12) << "ms/frame"
+        << std::setw(14) << "sin err" << std::setw(14) << "cos err" << std::setw(14) << "atan2 err" << std::endl;
+
+    float sink = 0;
+    double baseline = 0;
+    for (const TrigImpl& impl : impls) {
+        double ms = msPerFrame(impl, dx, dy, sink);
+        if (baseline == 0) baseline = ms;
+        double sinErr, cosErr, atanErr;
+        measureError(impl, sinErr, cosErr, atanErr);
+        std::cout << std::setw(12) << impl.name << std::fixed << std::setprecision(3) << std::setw(12) << ms
+            << std::scientific << std::setprecision(2) << std::setw(14) << sinErr << std::setw(14) << cosErr
+            << std::setw(14) << atanErr << std::fixed << std::setprecision(1) << "  (" << baseline / ms << "x)"
+            << std::endl;
+    }
+    std::cout << "(checksum " << sink << ")" << std::endl;
+    return 0;
+}
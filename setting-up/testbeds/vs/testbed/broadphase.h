@@ -0,0 +1,107 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+//   ε
+//    ũ  ,  ƽ ī ķ ٽ .
+//    Ʈ ڸ  ִ´.
+class UniformGrid {
+public:
+    UniformGrid(float left, float bottom, float right, float top, float cellSize)
+        : left(left), bottom(bottom), invCellSize(1.0f / cellSize) {
+        cols = std::max(1, (int)((right - left) * invCellSize + 0.999f));
+        rows = std::max(1, (int)((top - bottom) * invCellSize + 0.999f));
+        cellStart.assign(cols * rows + 1, 0);
+    }
+
+    // count build  Ҵ ʵ ̸ ´
+    void reserve(int count) {
+        itemCell.reserve(count);
+        cellItems.reserve(count);
+        cursor.reserve(cols * rows);
+    }
+
+    // getPos(i, x, y)  i° Ʈ ġ ޾ ڸ ٽ 
+    template <typename GetPos>
+    void build(int count, GetPos getPos) {
+        //  뷮 ǹǷ ִ   ڷδ Ҵ 
+        itemCell.resize(count);
+        cellItems.resize(count);
+        std::fill(cellStart.begin(), cellStart.end(), 0);
+
+        for (int i = 0; i < count; i++) {
+            float x, y;
+            getPos(i, x, y);
+            int cell = cellIndex(cellX(x), cellY(y));
+            itemCell[i] = cell;
+            cellStart[cell + 1]++;
+        }
+        for (int c = 0; c < cols * rows; c++) {
+            cellStart[c + 1] += cellStart[c];
+        }
+
+        //   ȿ ε  ȴ
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (int i = 0; i < count; i++) {
+            cellItems[cursor[itemCell[i]]++] = i;
+        }
+    }
+
+    // (x, y) ߽, radius ݰ 簢 ġ   ε  湮Ѵ
+    template <typename Visit>
+    void query(float x, float y, float radius, Visit visit) const {
+        int x0 = cellX(x - radius), x1 = cellX(x + radius);
+        int y0 = cellY(y - radius), y1 = cellY(y + radius);
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                int cell = cellIndex(cx, cy);
+                for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                    visit(cellItems[k]);
+                }
+            }
+        }
+    }
+
+private:
+    float left, bottom;
+    float invCellSize;
+    int cols, rows;
+    std::vector<int> cellStart; //   ġ (cols * rows + 1)
+    std::vector<int> cellItems; //   ĵ Ʈ ε
+    std::vector<int> itemCell;  // Ʈ  ȣ
+    std::vector<int> cursor;
+
+    int cellX(float x) const {
+        return std::min(cols - 1, std::max(0, (int)((x - left) * invCellSize)));
+    }
+    int cellY(float y) const {
+        return std::min(rows - 1, std::max(0, (int)((y - bottom) * invCellSize)));
+    }
+    int cellIndex(int cx, int cy) const { return cy * cols + cx; }
+};
+
+// - ħ  (sqrt  Ÿ  )
+inline bool circlesOverlap(float ax, float ay, float bx, float by, float radius) {
+    float dx = ax - bx;
+    float dy = ay - by;
+    return dx * dx + dy * dy < radius * radius;
+}
+
+// () :  ƽ  a (ax0, ay0)->(ax1, ay1), b (bx0, by0)->(bx1, by1)   ̵ 
+//    ̶ Ÿ radius   true.
+// b   ̵ а   ִ Ÿ ٲ Ǭ ( vs ŭ Ǯ ).
+//  Ѿ ƽ ̿ 븦    ´.
+inline bool sweptCirclesOverlap(float ax0, float ay0, float ax1, float ay1,
+    float bx0, float by0, float bx1, float by1, float radius) {
+    float px = ax0 - bx0, py = ay0 - by0;           //    ġ
+    float dx = (ax1 - bx1) - px, dy = (ay1 - by1) - py; //  ̵
+    float lengthSq = dx * dx + dy * dy;
+    float t = 0;
+    if (lengthSq > 0) {
+        t = -(px * dx + py * dy) / lengthSq;
+        t = std::min(1.0f, std::max(0.0f, t));
+    }
+    float cx = px + dx * t, cy = py + dy * t;
+    return cx * cx + cy * cy < radius * radius;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "glm_config.h"
+#include <glm/glm.hpp>
+#include <glm/simd/common.h>
+
+// Ѿ  +   Ŀ
+// pos += vel * dt    4(SSE) Ǵ 8(AVX2) óϰ,
+//  [minX, maxX] x [minY, maxY]   Ѿ б  active 0 .
+struct BulletBounds {
+    float minX, minY, maxX, maxY;
+};
+
+// Į  (SIMD     κп )
+inline void integrateBulletsScalar(float* px, float* py, const float* vx, const float* vy,
+    unsigned char* active, int count, float deltaTime, const BulletBounds& b) {
+    for (int i = 0; i < count; i++) {
+        float x = px[i] + vx[i] * deltaTime;
+        float y = py[i] + vy[i] * deltaTime;
+        px[i] = x;
+        py[i] = y;
+        active[i] &= (unsigned char)((x >= b.minX) & (x <= b.maxX) & (y >= b.minY) & (y <= b.maxY));
+    }
+}
+
+// p + v * dt     ݿøѴ (Į ο  ).
+// FMA  AVX2   Ȯ̶ AVX2 δ   , glm_vec4_fma  AVX2  յǾ
+//  SSE ڵ尡  ɼǿ  ٸ  .
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+inline glm_vec4 kernelMulAddSSE(glm_vec4 v, glm_vec4 dt, glm_vec4 p) {
+    return _mm_add_ps(_mm_mul_ps(v, dt), p);
+}
+
+// 4 ó: clamp      ̴
+inline void integrateBulletsSSE(float* px, float* py, const float* vx, const float* vy,
+    unsigned char* active, int count, float deltaTime, const BulletBounds& b) {
+    glm_vec4 const dt = _mm_set1_ps(deltaTime);
+    glm_vec4 const minX = _mm_set1_ps(b.minX), maxX = _mm_set1_ps(b.maxX);
+    glm_vec4 const minY = _mm_set1_ps(b.minY), maxY = _mm_set1_ps(b.maxY);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        glm_vec4 const x = kernelMulAddSSE(_mm_loadu_ps(vx + i), dt, _mm_loadu_ps(px + i));
+        glm_vec4 const y = kernelMulAddSSE(_mm_loadu_ps(vy + i), dt, _mm_loadu_ps(py + i));
+        _mm_storeu_ps(px + i, x);
+        _mm_storeu_ps(py + i, y);
+
+        glm_vec4 const inX = _mm_cmpeq_ps(glm_vec4_clamp(x, minX, maxX), x);
+        glm_vec4 const inY = _mm_cmpeq_ps(glm_vec4_clamp(y, minY, maxY), y);
+        int const mask = _mm_movemask_ps(_mm_and_ps(inX, inY));
+        active[i + 0] &= (unsigned char)(mask & 1);
+        active[i + 1] &= (unsigned char)((mask >> 1) & 1);
+        active[i + 2] &= (unsigned char)((mask >> 2) & 1);
+        active[i + 3] &= (unsigned char)((mask >> 3) & 1);
+    }
+    integrateBulletsScalar(px + i, py + i, vx + i, vy + i, active + i, count - i, deltaTime, b);
+}
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+inline __m256 kernelMulAddAVX2(__m256 v, __m256 dt, __m256 p) {
+    return _mm256_add_ps(_mm256_mul_ps(v, dt), p);
+}
+
+// 8 ó (glm 256Ʈ ۰     Ű)
+inline void integrateBulletsAVX2(float* px, float* py, const float* vx, const float* vy,
+    unsigned char* active, int count, float deltaTime, const BulletBounds& b) {
+    __m256 const dt = _mm256_set1_ps(deltaTime);
+    __m256 const minX = _mm256_set1_ps(b.minX), maxX = _mm256_set1_ps(b.maxX);
+    __m256 const minY = _mm256_set1_ps(b.minY), maxY = _mm256_set1_ps(b.maxY);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 const x = kernelMulAddAVX2(_mm256_loadu_ps(vx + i), dt, _mm256_loadu_ps(px + i));
+        __m256 const y = kernelMulAddAVX2(_mm256_loadu_ps(vy + i), dt, _mm256_loadu_ps(py + i));
+        _mm256_storeu_ps(px + i, x);
+        _mm256_storeu_ps(py + i, y);
+
+        __m256 const inX = _mm256_cmp_ps(_mm256_max_ps(_mm256_min_ps(x, maxX), minX), x, _CMP_EQ_OQ);
+        __m256 const inY = _mm256_cmp_ps(_mm256_max_ps(_mm256_min_ps(y, maxY), minY), y, _CMP_EQ_OQ);
+        int const mask = _mm256_movemask_ps(_mm256_and_ps(inX, inY));
+        for (int k = 0; k < 8; k++) {
+            active[i + k] &= (unsigned char)((mask >> k) & 1);
+        }
+    }
+    integrateBulletsSSE(px + i, py + i, vx + i, vy + i, active + i, count - i, deltaTime, b);
+}
+#endif
+
+//     ִ   θ 
+inline void integrateBullets(float* px, float* py, const float* vx, const float* vy,
+    unsigned char* active, int count, float deltaTime, const BulletBounds& b) {
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    integrateBulletsAVX2(px, py, vx, vy, active, count, deltaTime, b);
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    integrateBulletsSSE(px, py, vx, vy, active, count, deltaTime, b);
+#else
+    integrateBulletsScalar(px, py, vx, vy, active, count, deltaTime, b);
+#endif
+}
+
+inline const char* bulletKernelName() {
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    return "AVX2 (8 lanes)";
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    return "SSE2 (4 lanes)";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include "bullet_kernel.h"
+
+// Ѿ Ǯ (迭 ü )
+//  ִ Ѿ ׻ [0, count)  ϰ  ְ, [count, capacity) 
+//     Ѵ. 뷮     Ƿ Ӹ  Ҵ .
+//   size ̻  Ѿ а Բ Ȱȭȴ.
+class BulletPool {
+public:
+    std::vector<float> posX, posY;
+    std::vector<float> prevX, prevY; //  ƽ ġ ( )
+    std::vector<float> velX, velY;
+    std::vector<float> rotation;
+    std::vector<unsigned char> active;
+    int count;
+    int capacity;
+    float size; // 浹/ 
+    float spin; // ʴ ȸ (rad)
+
+    BulletPool(int capacity, float size, float spin = 0.0f)
+        : posX(capacity), posY(capacity), prevX(capacity), prevY(capacity),
+        velX(capacity), velY(capacity),
+        rotation(capacity), active(capacity), count(0), capacity(capacity),
+        size(size), spin(spin) {
+    }
+
+    // Ǯ    Ѿ  false ش
+    bool spawn(float x, float y, float vx, float vy, float rot) {
+        if (count >= capacity) return false;
+        int i = count++;
+        posX[i] = x;
+        posY[i] = y;
+        prevX[i] = x;
+        prevY[i] = y;
+        velX[i] = vx;
+        velY[i] = vy;
+        rotation[i] = rot;
+        active[i] = 1;
+        return true;
+    }
+
+    // n      ε ش (  Ѳ ä )
+    //  ڸ ڶ  ŭ  n δ. ä  prev active  Ѵ.
+    int allocate(int& n) {
+        n = std::max(0, std::min(n, capacity - count));
+        int first = count;
+        count += n;
+        return first;
+    }
+
+    // ġ а   SIMD Ŀη, ȸ   ó
+    void integrate(float deltaTime, float left, float bottom, float right, float top) {
+        integrateRange(0, count, deltaTime, left, bottom, right, top);
+    }
+
+    // [begin, end)  Ѵ.  ġ   忡 ÿ ҷ ȴ.
+    // begin 8 ̸ SIMD  谡 ü а   Ʈ  .
+    void integrateRange(int begin, int end, float deltaTime, float left, float bottom, float right, float top) {
+        BulletBounds bounds = { left - size, bottom - size, right + size, top + size };
+        integrateBullets(posX.data() + begin, posY.data() + begin, velX.data() + begin, velY.data() + begin,
+            active.data() + begin, end - begin, deltaTime, bounds);
+
+        if (spin != 0.0f) {
+            float* rot = rotation.data();
+            float step = deltaTime * spin;
+            for (int i = begin; i < end; i++) {
+                rot[i] += step;
+            }
+        }
+    }
+
+    void savePrevious() {
+        std::copy(posX.begin(), posX.begin() + count, prevX.begin());
+        std::copy(posY.begin(), posY.begin() + count, prevY.begin());
+    }
+
+    // Ȱ Ѿ ڸ  Ѿ Ű ä (  )
+    void compact() {
+        int i = 0;
+        while (i < count) {
+            if (active[i]) {
+                i++;
+                continue;
+            }
+            int last = --count;
+            posX[i] = posX[last];
+            posY[i] = posY[last];
+            prevX[i] = prevX[last];
+            prevY[i] = prevY[last];
+            velX[i] = velX[last];
+            velY[i] = velY[last];
+            rotation[i] = rotation[last];
+            active[i] = active[last];
+        }
+    }
+
+    void update(float deltaTime, float left, float bottom, float right, float top) {
+        integrate(deltaTime, left, bottom, right, top);
+        compact();
+    }
+
+    void clear() { count = 0; }
+
+    //  (snapshot.h):  ִ [0, count)  迭° а .
+    // 迭 SNAPSHOT_SLOTS   ڸ  ιǷ, Ѿ   ٲ  迭 ġ
+    // ״ο   ̰ ۴.
+    static const int SNAPSHOT_SLOTS = 256;
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar.value(count);
+        count = std::max(0, std::min(count, capacity)); // ߸  о 뷮  ʴ´
+        int slots = (count + SNAPSHOT_SLOTS - 1) / SNAPSHOT_SLOTS * SNAPSHOT_SLOTS;
+        ar.array(posX.data(), count, slots);
+        ar.array(posY.data(), count, slots);
+        ar.array(prevX.data(), count, slots);
+        ar.array(prevY.data(), count, slots);
+        ar.array(velX.data(), count, slots);
+        ar.array(velY.data(), count, slots);
+        ar.array(rotation.data(), count, slots);
+        ar.array(active.data(), count, slots);
+    }
+};
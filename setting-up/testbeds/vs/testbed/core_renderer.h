@@ -0,0 +1,361 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include "glm_config.h"
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "renderer.h"
+#include "shader.h"
+#include "stream_buffer.h"
+
+// ھ (GLSL 330) 鿣
+//      ϳ(Camera)   ī޶ 鸲 ̵ ־ ΰ,
+// ޽ø VAO ̸  ׸  VAO ε ο ݸ Ѵ.
+// νϽ ʹ  ε  (StreamBuffer) , Ȯ  ȭ ø.
+// rect   Ͽ  ξٰ  flush/drawMesh/beginUI  ο    ׸
+// (Ϸ HUD  Ӹ 簢   ׸).
+// ȣȯ   ȯ(Mesa llvmpipe )  θ  Ѵ.
+class CoreRenderer : public Renderer {
+public:
+    CoreRenderer() : spriteProgram(0), meshProgram(0), offsetLocation(-1), cameraUBO(0),
+        instanceVBO(0), rectVBO(0), meshVAO(0), rectVAO(0), characters(nullptr),
+        currentProgram(0), currentVAO(0) {
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            spriteVAO[i] = 0;
+            spriteVertices[i] = 0;
+            mappedOffset[i] = -1;
+        }
+        resetInstanceBindings();
+    }
+
+    bool init(const RenderMeshes& meshes) override {
+        if (!GLEW_VERSION_3_3) {
+            std::cerr << "ھ  OpenGL 3.3 ̻ ʿմϴ" << std::endl;
+            return false;
+        }
+
+        spriteProgram = linkProgram(SPRITE_VERTEX_SOURCE, COLOR_FRAGMENT_SOURCE);
+        meshProgram = linkProgram(MESH_VERTEX_SOURCE, COLOR_FRAGMENT_SOURCE);
+        if (!spriteProgram || !meshProgram) return false;
+        bindCameraBlock(spriteProgram);
+        bindCameraBlock(meshProgram);
+        offsetLocation = glGetUniformLocation(meshProgram, "uOffset");
+
+        glGenBuffers(1, &cameraUBO);
+        glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(CameraBlock), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BINDING, cameraUBO);
+
+        glGenBuffers(1, &instanceVBO);
+        glGenBuffers(1, &rectVBO);
+        rectVertices.reserve(RESERVED_RECT_VERTICES);
+        if (!instanceStream.init(STREAM_SEGMENT_BYTES)) {
+            std::cerr << "GL_ARB_buffer_storage : νϽ ۸ ȭ øϴ" << std::endl;
+        }
+
+        // Ʈ: ޽ (0) + νϽ ȯ(1) (2)
+        GLuint spriteVBO[SPRITE_COUNT];
+        spriteVBO[SPRITE_STAR] = meshes.starVBO;
+        spriteVBO[SPRITE_BULLET] = meshes.bulletVBO;
+        spriteVBO[SPRITE_CIRCLE] = meshes.circleVBO;
+        spriteVBO[SPRITE_SPARK] = meshes.sparkVBO;
+        spriteVertices[SPRITE_STAR] = meshes.starVertices;
+        spriteVertices[SPRITE_BULLET] = meshes.bulletVertices;
+        spriteVertices[SPRITE_CIRCLE] = meshes.circleVertices;
+        spriteVertices[SPRITE_SPARK] = meshes.sparkVertices;
+
+        glGenVertexArrays(SPRITE_COUNT, spriteVAO);
+        for (int m = 0; m < SPRITE_COUNT; m++) {
+            glBindVertexArray(spriteVAO[m]);
+            glBindBuffer(GL_ARRAY_BUFFER, spriteVBO[m]);
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+            glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance), (void*)0);
+            glVertexAttribDivisor(1, 1);
+            glEnableVertexAttribArray(2);
+            glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance), (void*)(4 * sizeof(float)));
+            glVertexAttribDivisor(2, 1);
+        }
+
+        // ĳ ޽ÿ UI 簢: ġ(0) + (1)
+        characters = meshes.characters;
+        glGenVertexArrays(1, &meshVAO);
+        setupColoredVertexArray(meshVAO, characters->buffer());
+        glGenVertexArrays(1, &rectVAO);
+        setupColoredVertexArray(rectVAO, rectVBO);
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        camera.projection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+        camera.view = glm::mat4(1.0f);
+        uploadCamera();
+        return true;
+    }
+
+    void cleanup() override {
+        instanceStream.cleanup();
+        if (spriteVAO[0]) glDeleteVertexArrays(SPRITE_COUNT, spriteVAO);
+        if (meshVAO) glDeleteVertexArrays(1, &meshVAO);
+        if (rectVAO) glDeleteVertexArrays(1, &rectVAO);
+        if (instanceVBO) glDeleteBuffers(1, &instanceVBO);
+        if (rectVBO) glDeleteBuffers(1, &rectVBO);
+        if (cameraUBO) glDeleteBuffers(1, &cameraUBO);
+        if (spriteProgram) glDeleteProgram(spriteProgram);
+        if (meshProgram) glDeleteProgram(meshProgram);
+        for (int i = 0; i < SPRITE_COUNT; i++) spriteVAO[i] = 0;
+        meshVAO = rectVAO = instanceVBO = rectVBO = cameraUBO = 0;
+        spriteProgram = meshProgram = 0;
+    }
+
+    const char* name() const override { return "core"; }
+
+    void resize(int width, int height) override {
+        glViewport(0, 0, width, height);
+        camera.projection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+        uploadCamera();
+    }
+
+    void beginFrame(float shakeX, float shakeY) override {
+        currentProgram = currentVAO = 0; //  ̿ ٸ ڵ尡 ¸ ٲ  ִ
+        instanceStream.nextFrame();
+        resetInstanceBindings(); //  ۰    ִ
+        resetStats();
+        glClear(GL_COLOR_BUFFER_BIT);
+        camera.view = glm::translate(glm::mat4(1.0f), glm::vec3(shakeX, shakeY, 0.0f));
+        uploadCamera();
+    }
+
+    void beginUI() override {
+        flushRects(); //   簢  ī޶ ׸
+        camera.view = glm::mat4(1.0f);
+        uploadCamera();
+    }
+
+    //  ۿ ڸ   ޸𸮸 ٷ ش (  GPU д´)
+    SpriteInstance* mapSprites(SpriteMesh mesh, int count) override {
+        GLintptr offset;
+        void* dst = instanceStream.allocate(count * sizeof(SpriteInstance), offset);
+        if (!dst) {
+            mappedOffset[mesh] = -1;
+            return Renderer::mapSprites(mesh, count);
+        }
+        mappedOffset[mesh] = offset;
+        return (SpriteInstance*)dst;
+    }
+
+    void commitSprites(SpriteMesh mesh, int count) override {
+        if (mappedOffset[mesh] < 0) {
+            Renderer::commitSprites(mesh, count);
+            return;
+        }
+        if (count > 0) {
+            MappedRange range = { mappedOffset[mesh], count };
+            mapped[mesh].push_back(range);
+        }
+        mappedOffset[mesh] = -1;
+    }
+
+    void flush() override {
+        flushRects(); // ó ٷ ׷     簢 Ʈ Ʒ 򸰴
+        for (int m = 0; m < SPRITE_COUNT; m++) {
+            std::vector<SpriteInstance>& list = sprites[m];
+            if (!list.empty()) {
+                GLsizeiptr bytes = list.size() * sizeof(SpriteInstance);
+                GLintptr offset = 0;
+                void* dst = instanceStream.allocate(bytes, offset);
+                if (dst) {
+                    memcpy(dst, list.data(), bytes);
+                    drawInstances(m, instanceStream.buffer(), offset, (int)list.size());
+                }
+                else {
+                    // ȭ:  ο찡 д   Ƿ Ź  Ҹ ޴´
+                    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+                    glBufferData(GL_ARRAY_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+                    glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, list.data());
+                    drawInstances(m, instanceVBO, 0, (int)list.size());
+                }
+                list.clear();
+            }
+
+            for (const MappedRange& range : mapped[m]) {
+                drawInstances(m, instanceStream.buffer(), range.offset, range.count);
+            }
+            mapped[m].clear();
+        }
+    }
+
+    void drawMesh(int mesh, float x, float y) override {
+        flushRects();
+        use(meshProgram, meshVAO);
+        glUniform2f(offsetLocation, x, y);
+        glDrawArrays(GL_TRIANGLES, characters->firstVertex(mesh), characters->vertexCount(mesh));
+        countDraw(1, characters->vertexCount(mesh));
+    }
+
+    void rect(float left, float bottom, float right, float top) override {
+        MeshVertex v[6] = {
+            { left, top, r, g, b }, { right, top, r, g, b }, { right, bottom, r, g, b },
+            { left, top, r, g, b }, { right, bottom, r, g, b }, { left, bottom, r, g, b },
+        };
+        rectVertices.insert(rectVertices.end(), v, v + 6);
+    }
+
+private:
+    // std140: mat4  
+    struct CameraBlock {
+        glm::mat4 projection;
+        glm::mat4 view;
+    };
+
+    // ؼ ä νϽ  (flush  ׸)
+    struct MappedRange {
+        GLintptr offset;
+        int count;
+    };
+
+    static const GLuint CAMERA_BINDING = 0;
+    static const GLsizeiptr STREAM_SEGMENT_BYTES = 1 << 20;
+    static const int RESERVED_RECT_VERTICES = 6 * 1024;
+
+    GLuint spriteProgram, meshProgram;
+    GLint offsetLocation;
+    GLuint cameraUBO, instanceVBO, rectVBO;
+    GLuint spriteVAO[SPRITE_COUNT];
+    int spriteVertices[SPRITE_COUNT];
+    GLuint meshVAO, rectVAO;
+    const MeshCache* characters;
+    CameraBlock camera;
+    GLuint currentProgram, currentVAO; //  ¸ ٽ  ʵ
+    StreamBuffer instanceStream;
+    GLintptr mappedOffset[SPRITE_COUNT]; //  ִ mapSprites  ġ (-1: ť  )
+    std::vector<MappedRange> mapped[SPRITE_COUNT];
+    GLuint boundInstanceVBO[SPRITE_COUNT]; // VAO νϽ Ӽ Ű ۿ ġ
+    GLintptr boundInstanceOffset[SPRITE_COUNT];
+    std::vector<MeshVertex> rectVertices; //  ׸  簢 (6)
+
+    //   簢     ÷   ׸ (ڸ  rectVBO  ȭ)
+    void flushRects() {
+        if (rectVertices.empty()) return;
+        int count = (int)rectVertices.size();
+        GLsizeiptr bytes = count * sizeof(MeshVertex);
+        GLintptr offset = 0;
+        void* dst = instanceStream.allocate(bytes, offset);
+        GLuint vbo = instanceStream.buffer();
+        if (dst) {
+            memcpy(dst, rectVertices.data(), bytes);
+        }
+        else {
+            vbo = rectVBO;
+            offset = 0;
+            glBindBuffer(GL_ARRAY_BUFFER, rectVBO);
+            glBufferData(GL_ARRAY_BUFFER, bytes, rectVertices.data(), GL_STREAM_DRAW);
+        }
+
+        use(meshProgram, rectVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offset);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)(offset + 2 * sizeof(float)));
+        glUniform2f(offsetLocation, 0, 0);
+        glDrawArrays(GL_TRIANGLES, 0, count);
+        countDraw(1, count);
+        rectVertices.clear();
+    }
+
+    void drawInstances(int mesh, GLuint vbo, GLintptr offset, int count) {
+        use(spriteProgram, spriteVAO[mesh]);
+        if (vbo != boundInstanceVBO[mesh] || offset != boundInstanceOffset[mesh]) {
+            glBindBuffer(GL_ARRAY_BUFFER, vbo);
+            glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance), (void*)offset);
+            glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+                (void*)(offset + 4 * sizeof(float)));
+            boundInstanceVBO[mesh] = vbo;
+            boundInstanceOffset[mesh] = offset;
+        }
+        glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, spriteVertices[mesh], count);
+        countDraw(1, (long long)spriteVertices[mesh] * count, count);
+    }
+
+    void resetInstanceBindings() {
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            boundInstanceVBO[i] = 0;
+            boundInstanceOffset[i] = -1;
+        }
+    }
+
+    void use(GLuint program, GLuint vao) {
+        if (program != currentProgram) {
+            glUseProgram(program);
+            currentProgram = program;
+        }
+        if (vao != currentVAO) {
+            glBindVertexArray(vao);
+            currentVAO = vao;
+        }
+    }
+
+    void uploadCamera() {
+        glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(CameraBlock), &camera);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    static void bindCameraBlock(GLuint program) {
+        GLuint index = glGetUniformBlockIndex(program, "Camera");
+        glUniformBlockBinding(program, index, CAMERA_BINDING);
+    }
+
+    static void setupColoredVertexArray(GLuint vao, GLuint vbo) {
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)(2 * sizeof(float)));
+    }
+
+    static constexpr const char* SPRITE_VERTEX_SOURCE =
+        "#version 330 core\n"
+        "layout(std140) uniform Camera { mat4 projection; mat4 view; };\n"
+        "layout(location = 0) in vec2 aPosition;\n"
+        "layout(location = 1) in vec4 aTransform;\n" // x, y, scale, rotation
+        "layout(location = 2) in vec3 aColor;\n"
+        "out vec3 vColor;\n"
+        "void main() {\n"
+        "    float c = cos(aTransform.w);\n"
+        "    float s = sin(aTransform.w);\n"
+        "    vec2 p = aPosition * aTransform.z;\n"
+        "    p = vec2(c * p.x - s * p.y, s * p.x + c * p.y) + aTransform.xy;\n"
+        "    gl_Position = projection * view * vec4(p, 0.0, 1.0);\n"
+        "    vColor = aColor;\n"
+        "}\n";
+
+    static constexpr const char* MESH_VERTEX_SOURCE =
+        "#version 330 core\n"
+        "layout(std140) uniform Camera { mat4 projection; mat4 view; };\n"
+        "layout(location = 0) in vec2 aPosition;\n"
+        "layout(location = 1) in vec3 aColor;\n"
+        "uniform vec2 uOffset;\n"
+        "out vec3 vColor;\n"
+        "void main() {\n"
+        "    gl_Position = projection * view * vec4(aPosition + uOffset, 0.0, 1.0);\n"
+        "    vColor = aColor;\n"
+        "}\n";
+
+    static constexpr const char* COLOR_FRAGMENT_SOURCE =
+        "#version 330 core\n"
+        "in vec3 vColor;\n"
+        "out vec4 fragColor;\n"
+        "void main() {\n"
+        "    fragColor = vec4(vColor, 1.0);\n"
+        "}\n";
+};
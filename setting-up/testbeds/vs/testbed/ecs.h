@@ -0,0 +1,175 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+
+// ƼƼ-Ʈ  (sparse set)
+// ƼƼ ȣǥ ̰, Ʈ   迭(dense)  ִ.
+// ý dense 迭 տ   Ƿ Ʈ  Լ θų
+//  ޸𸮸  ʴ´. sparse 迭 ƼƼ ȣ -> dense ġ̴.
+//
+//   Entity e = entities.create();
+//   transforms.add(e, Transform(pos));
+//   for (int i = 0; i < velocities.size(); i++) {
+//       Transform& t = transforms.get(velocities.entity(i));
+//       ...
+//   }
+//
+//   Ҹ  ڸ űǷ dense  ٲ (  ̴).
+// clear()  remove  뷮 ״ ιǷ  ¿ Ҵ .
+
+//  24Ʈ ȣ,  8Ʈ  ( ȣ ٽ    ڵ )
+typedef uint32_t Entity;
+
+const Entity NO_ENTITY = 0xffffffffu;
+const uint32_t ENTITY_INDEX_BITS = 24;
+const uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+
+inline uint32_t entityIndex(Entity e) { return e & ENTITY_INDEX_MASK; }
+inline uint32_t entityGeneration(Entity e) { return e >> ENTITY_INDEX_BITS; }
+
+// ƼƼ ȣ ߱ ( ȣ 븦 ÷ ٽ )
+class EntityRegistry {
+public:
+    void reserve(int count) {
+        generations.reserve(count);
+        freeList.reserve(count);
+    }
+
+    Entity create() {
+        uint32_t index;
+        if (!freeList.empty()) {
+            index = freeList.back();
+            freeList.pop_back();
+        }
+        else {
+            index = (uint32_t)generations.size();
+            assert(index <= ENTITY_INDEX_MASK);
+            generations.push_back(0);
+        }
+        aliveCount++;
+        return (generations[index] << ENTITY_INDEX_BITS) | index;
+    }
+
+    // Ʈ  ʴ´ (Game::destroyEntity  Ҹ )
+    void destroy(Entity e) {
+        if (!alive(e)) return;
+        uint32_t index = entityIndex(e);
+        generations[index] = (generations[index] + 1) & 0xff;
+        freeList.push_back(index);
+        aliveCount--;
+    }
+
+    bool alive(Entity e) const {
+        uint32_t index = entityIndex(e);
+        return index < generations.size() && generations[index] == entityGeneration(e);
+    }
+
+    int size() const { return aliveCount; }
+
+    //   Ͱ  · (ȣ 0 ٽ)
+    void clear() {
+        generations.clear();
+        freeList.clear();
+        aliveCount = 0;
+    }
+
+    //  (snapshot.h)
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar.vector(generations);
+        ar.vector(freeList);
+        ar.value(aliveCount);
+    }
+
+private:
+    std::vector<uint32_t> generations;
+    std::vector<uint32_t> freeList;
+    int aliveCount = 0;
+};
+
+// Ʈ   
+template <typename T>
+class ComponentStore {
+public:
+    void reserve(int count) {
+        dense.reserve(count);
+        owners.reserve(count);
+        sparse.reserve(count);
+    }
+
+    T& add(Entity e, const T& value) {
+        uint32_t index = entityIndex(e);
+        if (index >= sparse.size()) sparse.resize(index + 1, -1);
+        if (sparse[index] >= 0) {
+            dense[sparse[index]] = value;
+            owners[sparse[index]] = e;
+            return dense[sparse[index]];
+        }
+        sparse[index] = (int)dense.size();
+        dense.push_back(value);
+        owners.push_back(e);
+        return dense.back();
+    }
+
+    //  ƹ͵  ʴ´.  Ҹ ڸ ű.
+    void remove(Entity e) {
+        if (!has(e)) return;
+        uint32_t index = entityIndex(e);
+        int slot = sparse[index];
+        int last = (int)dense.size() - 1;
+        if (slot != last) {
+            dense[slot] = dense[last];
+            owners[slot] = owners[last];
+            sparse[entityIndex(owners[slot])] = slot;
+        }
+        dense.pop_back();
+        owners.pop_back();
+        sparse[index] = -1;
+    }
+
+    bool has(Entity e) const {
+        uint32_t index = entityIndex(e);
+        return index < sparse.size() && sparse[index] >= 0 && owners[sparse[index]] == e;
+    }
+
+    T& get(Entity e) {
+        assert(has(e));
+        return dense[sparse[entityIndex(e)]];
+    }
+    const T& get(Entity e) const {
+        assert(has(e));
+        return dense[sparse[entityIndex(e)]];
+    }
+
+    //  nullptr
+    T* find(Entity e) { return has(e) ? &dense[sparse[entityIndex(e)]] : nullptr; }
+    const T* find(Entity e) const { return has(e) ? &dense[sparse[entityIndex(e)]] : nullptr; }
+
+    // dense  ȱ
+    int size() const { return (int)dense.size(); }
+    bool empty() const { return dense.empty(); }
+    T& operator[](int i) { return dense[i]; }
+    const T& operator[](int i) const { return dense[i]; }
+    Entity entity(int i) const { return owners[i]; }
+
+    void clear() {
+        dense.clear();
+        owners.clear();
+        sparse.clear();
+    }
+
+    //  (snapshot.h):  迭 ״ а  (T  memcpy    ־ Ѵ)
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar.vector(dense);
+        ar.vector(owners);
+        ar.vector(sparse);
+    }
+
+private:
+    std::vector<T> dense;
+    std::vector<Entity> owners; // dense    ƼƼ
+    std::vector<int> sparse;    // ƼƼ ȣ -> dense ġ (-1  )
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+//    ﰢԼ
+// TRIG_MODE      (⺻: ǥ).
+//   TRIG_MODE_STD    std::sin/cos/atan2
+//   TRIG_MODE_POLY   glm::fastSin/fastCos, ִ  7.1e-6
+//   TRIG_MODE_TABLE  4096ĭ ǥ +  , ִ  6.2e-7
+// POLY/TABLE  atan2  Ʒ ׽ (ִ  2.0e-6 rad).
+//  bench_trig.cpp  [-2, 2]  Ⱦ  ̸,  Ŀ float ü
+// е  þ (|x| = 100 ó  1.5e-5).
+//  ޽ó    ǥ е ߿ϹǷ std Լ ״ .
+//
+// ӵ (g++ -O2, SSE2, ھ 1 VM, 3ȸ):
+//   bench_trig (10 ƼƼ)  std 5.8~7.2ms, poly 4.0~5.0ms, table 3.4~3.8ms / 
+//   headless --ticks 36000 --runs 5 (帶 -DTRIG_MODE=...  , 7ȸ ߾Ӱ)
+//     std 12.0M, poly 10.6M, table 11.0M ticks/s. ùķ̼ǿ ﰢԼ  ۾
+//     ̰  (ึ +-30%) ȿ .
+#include <cmath>
+
+#include "glm_config.h"
+#ifndef GLM_ENABLE_EXPERIMENTAL // gtx Ȯ (fast_trigonometry)
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+
+#define TRIG_MODE_STD 0
+#define TRIG_MODE_POLY 1
+#define TRIG_MODE_TABLE 2
+
+#ifndef TRIG_MODE
+#define TRIG_MODE TRIG_MODE_TABLE
+#endif
+
+// ׽ (glm)
+inline float sinPoly(float x) { return glm::fastSin(x); }
+inline float cosPoly(float x) { return glm::fastCos(x); }
+
+// glm::fastAtan  Ϸ ޼ |x|  1   ũ и鵵  ʴ´.
+// [0, 1]    ִּ ׽  и  Ѵ.
+inline float atan2Poly(float y, float x) {
+    float ax = std::abs(x), ay = std::abs(y);
+    float hi = ax > ay ? ax : ay;
+    if (hi == 0.0f) return 0.0f;
+    float t = (ax < ay ? ax : ay) / hi;
+    float t2 = t * t;
+    float r = t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f
+        + t2 * (-0.11643287f + t2 * (0.05265332f + t2 * -0.01172120f)))));
+    if (ay > ax) r = glm::half_pi<float>() - r;
+    if (x < 0) r = glm::pi<float>() - r;
+    return y < 0 ? -r : r;
+}
+
+// ǥ
+const int TRIG_TABLE_SIZE = 4096; // 2 ŵ
+
+struct SinTable {
+    float values[TRIG_TABLE_SIZE + 1];
+
+    SinTable() {
+        for (int i = 0; i <= TRIG_TABLE_SIZE; i++) {
+            values[i] = (float)std::sin(i * 2.0 * 3.14159265358979323846 / TRIG_TABLE_SIZE);
+        }
+    }
+};
+
+//  ü ڿ ҷ ϵ Լ    д
+inline const SinTable& sinTable() {
+    static const SinTable table;
+    return table;
+}
+
+inline float sinTableLookup(float x) {
+    const float scale = TRIG_TABLE_SIZE / glm::two_pi<float>();
+    float f = x * scale;
+    float base = std::floor(f);
+    float frac = f - base;
+    int i = (int)(long long)base & (TRIG_TABLE_SIZE - 1);
+    const float* v = sinTable().values;
+    return v[i] + (v[i + 1] - v[i]) * frac;
+}
+
+inline float cosTableLookup(float x) {
+    return sinTableLookup(x + glm::half_pi<float>());
+}
+
+// õ 
+inline float trigSin(float x) {
+#if TRIG_MODE == TRIG_MODE_TABLE
+    return sinTableLookup(x);
+#elif TRIG_MODE == TRIG_MODE_POLY
+    return sinPoly(x);
+#else
+    return std::sin(x);
+#endif
+}
+
+inline float trigCos(float x) {
+#if TRIG_MODE == TRIG_MODE_TABLE
+    return cosTableLookup(x);
+#elif TRIG_MODE == TRIG_MODE_POLY
+    return cosPoly(x);
+#else
+    return std::cos(x);
+#endif
+}
+
+inline void trigSinCos(float x, float& s, float& c) {
+    s = trigSin(x);
+    c = trigCos(x);
+}
+
+inline float trigAtan2(float y, float x) {
+#if TRIG_MODE == TRIG_MODE_STD
+    return std::atan2(y, x);
+#else
+    return atan2Poly(y, x);
+#endif
+}
+
+inline const char* trigModeName() {
+#if TRIG_MODE == TRIG_MODE_TABLE
+    return "table";
+#elif TRIG_MODE == TRIG_MODE_POLY
+    return "poly";
+#else
+    return "std";
+#endif
+}
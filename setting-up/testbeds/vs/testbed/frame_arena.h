@@ -0,0 +1,112 @@
+#pragma once
+
+// std::pmr  C++17  ִ (MSVC  testbed.vcxproj  LanguageStandard = stdcpp17)
+#if (defined(_MSVC_LANG) && _MSVC_LANG < 201703L) || (!defined(_MSVC_LANG) && __cplusplus < 201703L)
+#error "frame_arena.h: C++17  ؾ Ѵ (/std:c++17, -std=c++17)"
+#endif
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+//  ӽ ޸ ( Ҵ)
+//  ϳ ͸ о   ְ,  ۿ reset()  Ѳ ǵ.
+//   Ƿ malloc/free 뵵 ȭ .
+//  ڶ   ȸ   Ͽ  ְ,  reset 
+// ִ 뷮   Ű ( ¿ Ҵ ).
+//
+// reset() ڿ    ޸𸮸   ȴ.
+// std::pmr ̳ʿ  ArenaResource  Ѵ:
+//   std::pmr::vector<float> scratch(&frameScratch);
+class FrameArena {
+public:
+    static const size_t DEFAULT_CAPACITY = 1 << 20;
+
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY)
+        : block(new unsigned char[capacity]), blockSize(capacity), offset(0), overflowBytes(0), peak(0) {}
+
+    ~FrameArena() {
+        releaseOverflow();
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        uintptr_t base = (uintptr_t)block.get();
+        size_t start = (size_t)(((base + offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base);
+        if (start + bytes <= blockSize) {
+            offset = start + bytes;
+            peak = std::max(peak, offset + overflowBytes);
+            return block.get() + start;
+        }
+        return allocateOverflow(bytes, alignment);
+    }
+
+    // ̹ ӿ   ޸𸮸  ǵ
+    void reset() {
+        releaseOverflow();
+        if (peak > blockSize) {
+            // ģ ŭ  Ű  Ӻʹ  Ͽ  Ѵ
+            size_t size = blockSize;
+            while (size < peak) size *= 2;
+            block.reset(new unsigned char[size]);
+            blockSize = size;
+        }
+        offset = 0;
+        peak = 0;
+    }
+
+    size_t used() const { return offset + overflowBytes; }
+    size_t capacity() const { return blockSize; }
+
+private:
+    std::unique_ptr<unsigned char[]> block;
+    size_t blockSize;
+    size_t offset;
+    std::vector<void*> overflow; //  ڶ    ޸ (reset  )
+    size_t overflowBytes;
+    size_t peak; // ̹  ִ 뷮
+
+    void* allocateOverflow(size_t bytes, size_t alignment) {
+        void* raw = std::malloc(bytes + alignment);
+        if (!raw) throw std::bad_alloc();
+        overflow.push_back(raw);
+        overflowBytes += bytes + alignment;
+        peak = std::max(peak, offset + overflowBytes);
+        uintptr_t p = ((uintptr_t)raw + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        return (void*)p;
+    }
+
+    void releaseOverflow() {
+        for (void* p : overflow) std::free(p);
+        overflow.clear();
+        overflowBytes = 0;
+    }
+};
+
+// FrameArena  std::pmr::memory_resource    ( ϰ reset  Ѳ)
+class ArenaResource : public std::pmr::memory_resource {
+public:
+    explicit ArenaResource(FrameArena& arena) : arena(arena) {}
+
+    FrameArena& owner() const { return arena; }
+
+private:
+    FrameArena& arena;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return arena.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+//  ӵ 
+// steady_clock    , ǥ ֱ 忡   ð ٸ.
+//  ð "  + ֱ" Ƿ ׸ ð ų ݿø   ʴ´.
+// ٸ    sleep ϰ  ª ð 鼭(spin) .
+// sleep  ʰ   缭 spin   Ѵ.
+//
+//   scheduler.waitForNextFrame();
+//   double dt = scheduler.beginFrame(); //  ,  beginFrame 
+enum PacingMode {
+    PACING_VSYNC,     // ٸ ʴ´ ( ü    ش)
+    PACING_UNCAPPED,  // ٸ ʴ´ (  )
+    PACING_TARGET_HZ  // ǥ ֱ⿡  sleep + spin
+};
+
+// ֱ    (ms)
+struct FrameStats {
+    int frames;
+    double averageMs;
+    double minMs;
+    double maxMs;
+    double jitterMs;  // ǥ
+    int late;         // ǥ ֱ 1.5踦 ѱ   (ǥ  )
+};
+
+class FrameScheduler {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static const int HISTORY = 240;
+
+    explicit FrameScheduler(PacingMode mode = PACING_TARGET_HZ, double hz = 60.0)
+        : deltas(HISTORY, 0.0), deltaNext(0), deltaCount(0), started(false),
+        sleepMargin(std::chrono::microseconds(2000)), oversleepMicros(1000.0) {
+        setMode(mode, hz);
+    }
+
+    void setMode(PacingMode newMode, double hz = 60.0) {
+        mode = newMode;
+        targetHz = hz > 0 ? hz : 60.0;
+        period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetHz));
+        deadline = Clock::now() + period;
+    }
+
+    PacingMode pacing() const { return mode; }
+    double hz() const { return targetHz; }
+
+    // ǥ ֱ 忡    ٸ
+    void waitForNextFrame() {
+        if (mode != PACING_TARGET_HZ) return;
+
+        Clock::time_point now = Clock::now();
+        if (now >= deadline) {
+            //  ֱ Ѱ з   ʰ ݺ ٽ 
+            if (now - deadline > period) deadline = now;
+            deadline += period;
+            return;
+        }
+
+        //   sleep
+        Clock::time_point wake = deadline - sleepMargin;
+        if (now < wake) {
+            std::this_thread::sleep_until(wake);
+            Clock::time_point woke = Clock::now();
+            adaptMargin(std::chrono::duration<double, std::micro>(woke - wake).count());
+        }
+
+        //  ð spin
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        deadline += period;
+    }
+
+    //   ð   Ӻ () ش. ù ȣ 0.
+    double beginFrame() {
+        Clock::time_point now = Clock::now();
+        double dt = started ? std::chrono::duration<double>(now - frameStart).count() : 0.0;
+        if (started) {
+            deltas[deltaNext] = dt * 1000.0;
+            deltaNext = (deltaNext + 1) % HISTORY;
+            deltaCount = std::min(deltaCount + 1, HISTORY);
+        }
+        frameStart = now;
+        started = true;
+        return dt;
+    }
+
+    // ٰ ٽ   ( beginFrame  0 ش)
+    void reset() {
+        started = false;
+        deadline = Clock::now() + period;
+    }
+
+    FrameStats stats() const {
+        FrameStats s = { deltaCount, 0, 0, 0, 0, 0 };
+        if (deltaCount == 0) return s;
+
+        double sum = 0;
+        s.minMs = deltas[0];
+        s.maxMs = deltas[0];
+        for (int i = 0; i < deltaCount; i++) {
+            sum += deltas[i];
+            s.minMs = std::min(s.minMs, deltas[i]);
+            s.maxMs = std::max(s.maxMs, deltas[i]);
+        }
+        s.averageMs = sum / deltaCount;
+
+        double variance = 0;
+        double lateMs = 1500.0 / targetHz;
+        for (int i = 0; i < deltaCount; i++) {
+            double d = deltas[i] - s.averageMs;
+            variance += d * d;
+            if (mode != PACING_UNCAPPED && deltas[i] > lateMs) s.late++;
+        }
+        s.jitterMs = std::sqrt(variance / deltaCount);
+        return s;
+    }
+
+private:
+    PacingMode mode;
+    double targetHz;
+    Clock::duration period;
+    Clock::time_point deadline;
+    Clock::time_point frameStart;
+    std::vector<double> deltas; // ֱ   (ms, )
+    int deltaNext, deltaCount;
+    bool started;
+    Clock::duration sleepMargin;  //  ̸ŭ   spin Ѵ
+    double oversleepMicros;       // sleep  ʰ   ̵ 
+
+    // ʰ    踦 spin  ´ (0.25ms ~ 4ms)
+    void adaptMargin(double oversleep) {
+        oversleepMicros = oversleepMicros * 0.9 + std::max(0.0, oversleep) * 0.1;
+        double margin = std::min(4000.0, std::max(250.0, oversleepMicros * 2.0));
+        sleepMargin = std::chrono::microseconds((long long)margin);
+    }
+};
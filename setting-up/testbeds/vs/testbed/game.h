@@ -0,0 +1,855 @@
+#pragma once
+
+//  ùķ̼ (GL/GLUT  )
+// GLUT (assn1.cpp) â   headless.cpp  Բ .
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include "broadphase.h"
+#include "ecs.h"
+#include "bullet_pool.h"
+#include "jobs.h"
+#include "patterns.h"
+#include "rng.h"
+#include "particles.h"
+#include "fast_trig.h"
+#include "game_clock.h"
+#include "profiler.h"
+
+//  
+const float GAME_LEFT = -1.0f;
+const float GAME_RIGHT = 1.0f;
+const float GAME_BOTTOM = -1.0f;
+const float GAME_TOP = 1.0f;
+
+// ƼƼ ũ
+const float PLAYER_SIZE = 0.08f;
+const float BULLET_SIZE = 0.015f;
+const float ATTACK_SIZE = 0.025f;
+const float ENEMY_SIZE = 0.12f;
+
+//  
+const int PLAYER_LIVES = 3;
+const float ENEMY_HEALTH = 100.0f;
+const float ATTACK_DAMAGE = 10.0f;
+const float RESPAWN_TIME = 2.0f;
+
+//  
+const float ATTACK_SPEED = 2.0f;
+const float ATTACK_SPIN = 10.0f;
+
+// Ѿ Ǯ 뷮
+const int MAX_BULLETS = 100000;
+const int MAX_ATTACKS = 1000;
+
+// ùķ̼  ƽ (ȭ ֻ ϰ 120Hz )
+const float SIM_HZ = 120.0f;
+const float SIM_DT = 1.0f / SIM_HZ;
+
+// 浹   ũ ( ū 浹 ݰ溸 ణ ũ)
+const float COLLISION_CELL_SIZE = 0.125f;
+
+//  ó : ̺   ȯ   ũǷ  忡 ó
+// ûũ ũ SIMD (ִ 8)    ο  
+const int PARALLEL_MIN_BULLETS = 16384;
+const int PARALLEL_CHUNK = 4096;
+
+// ƼŬ (particles.h).      ͺ 
+const int MAX_PARTICLES = 8192;
+const float PARTICLE_DRAG = 0.05f;    // 1   ӵ 
+const int HIT_SPARKS = 8;            //    
+const int PLAYER_HIT_SPARKS = 32;    // ÷̾ ǰ
+const int EXPLOSION_PARTICLES = 160; //  ı
+
+enum ParticleKind { PARTICLE_HIT, PARTICLE_PLAYER_HIT, PARTICLE_EXPLOSION, PARTICLE_KIND_COUNT };
+
+// ӷ, , ũ, ó  ->   
+const ParticleStyle PARTICLE_STYLES[PARTICLE_KIND_COUNT] = {
+    { 0.4f, 1.2f, 0.15f, 0.35f, 0.02f, 1.0f, 1.0f, 0.7f, 1.0f, 0.5f, 0.1f }, //  Ҳ
+    { 0.3f, 1.0f, 0.3f, 0.7f, 0.025f, 1.0f, 0.8f, 0.9f, 0.8f, 0.2f, 0.4f },  // ȫ (÷̾ Ӹ)
+    { 0.2f, 1.6f, 0.4f, 1.2f, 0.035f, 1.0f, 0.9f, 0.5f, 0.6f, 0.1f, 0.05f }, // Ȳ 
+};
+
+// 浹  
+// DISCRETE  ƽ  ġ , SWEPT  ƽ  ̵  ü .
+// ƽ ų( SIM_HZ, ū --dt) Ѿ  DISCRETE  븦    ִ.
+enum CollisionMode { COLLISION_DISCRETE, COLLISION_SWEPT };
+
+//  Ʈ (rng.h). ý۸  ξ ʿ ̴ Ƚ ٸ   ٲ ʴ´.
+// ȣ õ Բ Ű ǹǷ  ٲٸ  õ ٸ  ȴ ( Ʈ ڿ).
+enum RandomStreamId {
+    RANDOM_PATTERNS, // ź Ѹ (PatternDef::spread)
+    RANDOM_ENEMY_AI, //  ġ 
+    RANDOM_PARTICLES, // ƼŬ /ӷ/
+    RANDOM_STREAM_COUNT
+};
+
+//   ̸  δ 浹 /ƼƼ 뷮 ( þ,   þ 뷮  ʴ´)
+const int RESERVED_HITS = 256;
+const int RESERVED_ENTITIES = 256;
+
+//  ü
+struct Vec2 {
+    float x, y;
+    Vec2(float x = 0, float y = 0) : x(x), y(y) {}
+    Vec2 operator+(const Vec2& other) const { return Vec2(x + other.x, y + other.y); }
+    Vec2 operator-(const Vec2& other) const { return Vec2(x - other.x, y - other.y); }
+    Vec2 operator*(float scalar) const { return Vec2(x * scalar, y * scalar); }
+    float length() const { return sqrt(x * x + y * y); }
+    Vec2 normalized() const {
+        float len = length();
+        return len > 0 ? Vec2(x / len, y / len) : Vec2(0, 0);
+    }
+};
+
+//  ƽ  ƽ   (alpha: 0 = , 1 = )
+inline Vec2 lerp(const Vec2& a, const Vec2& b, float alpha) {
+    return a + (b - a) * alpha;
+}
+
+// ī޶ 鸲 ȿ
+struct CameraShake {
+    float shake;
+    float decay;
+    Vec2 offset;
+
+    Phase phaseX, phaseY; // 鸲   (ʴ 50, 65 rad)
+
+    CameraShake() : shake(0.0f), decay(5.0f), offset(0, 0) {}
+
+    void add(float intensity) {
+        shake = std::max(shake, intensity);
+    }
+
+    void update(float deltaTime) {
+        phaseX.advance(50.0f, deltaTime);
+        phaseY.advance(65.0f, deltaTime);
+        if (shake > 0) {
+            offset.x = trigSin(phaseX.signedRadians()) * shake * 0.02f;
+            offset.y = trigCos(phaseY.signedRadians()) * shake * 0.02f;
+            shake -= decay * deltaTime;
+            if (shake < 0) shake = 0;
+        }
+        else {
+            offset.x = 0;
+            offset.y = 0;
+        }
+    }
+};
+
+// Է Ʈ
+enum InputBits {
+    INPUT_UP = 1 << 0,
+    INPUT_DOWN = 1 << 1,
+    INPUT_LEFT = 1 << 2,
+    INPUT_RIGHT = 1 << 3,
+    INPUT_FIRE = 1 << 4
+};
+
+// Ʈ (ecs.h ҿ  δ)
+// ÷̾: Transform, Velocity, Collider, Renderable, PlayerState
+// : Transform, Velocity, Collider, Health, Renderable, EnemyState
+// ź ߻: Emitter (  ġ )
+
+struct Transform {
+    Vec2 position;
+    Vec2 prevPosition; //  ƽ ġ ( )
+
+    Transform(Vec2 pos = Vec2()) : position(pos), prevPosition(pos) {}
+
+    Vec2 renderPosition(float alpha) const {
+        return lerp(prevPosition, position, alpha);
+    }
+};
+
+struct Velocity {
+    Vec2 value;
+};
+
+struct Collider {
+    float size;
+    bool active; // false    ʴ´ (Ȱ   ÷̾)
+
+    Collider(float size = 0) : size(size), active(true) {}
+
+    float collisionRadius(float otherSize) const {
+        return (size + otherSize) * 0.8f; // ణ   浹 
+    }
+};
+
+struct Health {
+    float value;
+    float max;
+
+    Health(float max = 0) : value(max), max(max) {}
+};
+
+enum RenderKind { RENDER_PLAYER, RENDER_ENEMY };
+
+struct Renderable {
+    RenderKind kind;
+    Phase anim;      // ִϸ̼ 
+    float animSpeed; // ʴ rad
+
+    Renderable(RenderKind kind = RENDER_PLAYER, float animSpeed = 0) : kind(kind), animSpeed(animSpeed) {}
+};
+
+// ÷̾ (̵ ĳ Ƽ)
+struct PlayerState {
+    int lives;
+    float respawnTimer;
+    bool isRespawning;
+    Vec2 spawn; // Ȱ ġ
+
+    PlayerState(Vec2 spawn = Vec2()) : lives(PLAYER_LIVES), respawnTimer(0), isRespawning(false), spawn(spawn) {}
+};
+
+//  (ũ  ĳ)
+struct EnemyState {
+    Phase move; // ¿ ̵  (ʴ 0.8 rad)
+};
+
+struct Emitter {
+    Entity owner;
+    PatternEmitter state;
+
+    Emitter(Entity owner = NO_ENTITY, int pattern = 0) : owner(owner), state(pattern) {}
+};
+
+//  ؽ  (FNV-1a 64Ʈ)
+struct StateHasher {
+    uint64_t value;
+
+    StateHasher() : value(14695981039346656037ULL) {}
+
+    void addBytes(const void* data, size_t size) {
+        const unsigned char* bytes = (const unsigned char*)data;
+        for (size_t i = 0; i < size; i++) {
+            value = (value ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+
+    template <typename T>
+    void add(const T& v) { addBytes(&v, sizeof(v)); }
+
+    void addPool(const BulletPool& pool) {
+        add(pool.count);
+        addBytes(pool.posX.data(), pool.count * sizeof(float));
+        addBytes(pool.posY.data(), pool.count * sizeof(float));
+        addBytes(pool.velX.data(), pool.count * sizeof(float));
+        addBytes(pool.velY.data(), pool.count * sizeof(float));
+        addBytes(pool.rotation.data(), pool.count * sizeof(float));
+        addBytes(pool.active.data(), pool.count);
+    }
+};
+
+//  Ŭ
+// ÷̾  ƼƼ̰, ƽ ý Ʈ 迭    ȴ´.
+//      ִ (enemyCount  ϰ reset).
+class Game {
+public:
+    // ƼƼ Ʈ 
+    EntityRegistry entities;
+    ComponentStore<Transform> transforms;
+    ComponentStore<Velocity> velocities;
+    ComponentStore<Collider> colliders;
+    ComponentStore<Health> healths;
+    ComponentStore<Renderable> renderables;
+    ComponentStore<PlayerState> players;
+    ComponentStore<EnemyState> enemies;
+    ComponentStore<Emitter> emitters;
+    int playerCount; // reset   
+    int enemyCount;
+
+    BulletPool attacks;
+    BulletPool bullets;
+    bool gameOver;
+    bool gameWon;
+    GameClock clock; //  ƽ 
+    CameraShake camera;
+    ParticleSystem particles; // ̱⸸ ϴ ȿ ( ؽ,   ʴ´)
+    unsigned int seed; //  õ ( ؽÿ )
+    RandomStream rng[RANDOM_STREAM_COUNT]; // seed   ýۺ  (reset  ó)
+    std::vector<PatternDef> patterns; //  ź  (patterns.txt Ǵ ⺻ ä)
+
+    // 浹 ε ( ƽ ٽ )
+    UniformGrid attackGrid;
+    UniformGrid bulletGrid;
+    std::vector<int> hits;
+    std::vector<Entity> defeated; // ̹ ƽ   (浹 ó   )
+
+    CollisionMode collisionMode;
+
+    // ۾ Ǯ (  ȣ 忡 ó).   ̵ .
+    JobPool* jobs;
+    std::vector<std::vector<int>> chunkHits; // ûũ 浹  (ûũ  ģ)
+
+    Game(unsigned int seed = 0, JobPool* jobs = nullptr) : playerCount(1), enemyCount(1),
+        attacks(MAX_ATTACKS, ATTACK_SIZE, ATTACK_SPIN),
+        bullets(MAX_BULLETS, BULLET_SIZE), gameOver(false), gameWon(false),
+        particles(MAX_PARTICLES, PARTICLE_STYLES, PARTICLE_DRAG), seed(seed),
+        attackGrid(GAME_LEFT, GAME_BOTTOM, GAME_RIGHT, GAME_TOP, COLLISION_CELL_SIZE),
+        bulletGrid(GAME_LEFT, GAME_BOTTOM, GAME_RIGHT, GAME_TOP, COLLISION_CELL_SIZE),
+        collisionMode(COLLISION_DISCRETE), jobs(jobs) {
+        reserveEntities(RESERVED_ENTITIES);
+        //  δ PARALLEL_MIN_BULLETS  ̸  ̹Ƿ ׸ŭ̸ ϴ
+        attackGrid.reserve(MAX_ATTACKS);
+        bulletGrid.reserve(std::min(MAX_BULLETS, PARALLEL_MIN_BULLETS));
+        hits.reserve(RESERVED_HITS);
+        defeated.reserve(RESERVED_ENTITIES);
+        chunkHits.reserve(JobPool::chunkCount(MAX_BULLETS, PARALLEL_CHUNK));
+        patterns = defaultPatterns();
+        seedRandom();
+        spawnWorld();
+    }
+
+    //   ǵ. Ǯ, Ʈ , ۾  뷮 ״ ιǷ  Ҵ 
+    // (game = Game()  Ѿ 迭   ´).  ϰ ߻ Ÿ̸Ӹ ó.
+    // playerCount/enemyCount  ٲ ⼭  ŭ ٽ .
+    void reset(unsigned int newSeed) {
+        seed = newSeed;
+        seedRandom();
+        clearWorld();
+        spawnWorld();
+
+        attacks.clear();
+        bullets.clear();
+        hits.clear();
+        gameOver = false;
+        gameWon = false;
+        clock = GameClock();
+        camera = CameraShake();
+        particles.clear();
+    }
+
+    //  ٲٸ ߻ Ÿ̸ӵ ó ٽ 
+    void setPatterns(const std::vector<PatternDef>& list) {
+        patterns = list;
+        for (int i = emitters.size() - 1; i >= 0; i--) {
+            destroyEntity(emitters.entity(i));
+        }
+        for (int i = 0; i < enemies.size(); i++) {
+            addEmitters(enemies.entity(i));
+        }
+    }
+
+    void reserveEntities(int count) {
+        entities.reserve(count);
+        transforms.reserve(count);
+        velocities.reserve(count);
+        colliders.reserve(count);
+        healths.reserve(count);
+        renderables.reserve(count);
+        players.reserve(count);
+        enemies.reserve(count);
+        emitters.reserve(count);
+    }
+
+    Entity spawnPlayer(Vec2 position) {
+        Entity e = entities.create();
+        transforms.add(e, Transform(position));
+        velocities.add(e, Velocity());
+        colliders.add(e, Collider(PLAYER_SIZE));
+        renderables.add(e, Renderable(RENDER_PLAYER, 3.0f));
+        players.add(e, PlayerState(position));
+        return e;
+    }
+
+    Entity spawnEnemy(Vec2 position) {
+        Entity e = entities.create();
+        transforms.add(e, Transform(position));
+        velocities.add(e, Velocity());
+        colliders.add(e, Collider(ENEMY_SIZE));
+        healths.add(e, Health(ENEMY_HEALTH));
+        renderables.add(e, Renderable(RENDER_ENEMY, 2.0f));
+        enemies.add(e, EnemyState());
+        addEmitters(e);
+        return e;
+    }
+
+    // Ҹ  ( Ʈ ǳʶڴ)
+    void destroyEntity(Entity e) {
+        transforms.remove(e);
+        velocities.remove(e);
+        colliders.remove(e);
+        healths.remove(e);
+        renderables.remove(e);
+        players.remove(e);
+        enemies.remove(e);
+        emitters.remove(e);
+        entities.destroy(e);
+    }
+
+    //    ߻⸦ Բ 
+    void destroyEnemy(Entity e) {
+        for (int i = emitters.size() - 1; i >= 0; i--) {
+            if (emitters[i].owner == e) destroyEntity(emitters.entity(i));
+        }
+        destroyEntity(e);
+    }
+
+    // slot ° ÷̾ ( NO_ENTITY)
+    Entity playerEntity(int slot = 0) const {
+        return slot < players.size() ? players.entity(slot) : NO_ENTITY;
+    }
+
+    bool runParallel(const BulletPool& pool) const {
+        return jobs && jobs->workerCount() > 0 && pool.count >= PARALLEL_MIN_BULLETS;
+    }
+
+    // Ѿ  ûũ   忡 Ѵ (  ߿ϹǷ  忡)
+    void updatePool(BulletPool& pool, float deltaTime) {
+        {
+            PROFILE_SCOPE(PROFILE_INTEGRATE);
+            if (!runParallel(pool)) {
+                pool.integrate(deltaTime, GAME_LEFT, GAME_BOTTOM, GAME_RIGHT, GAME_TOP);
+            }
+            else {
+                jobs->parallelFor(pool.count, PARALLEL_CHUNK, [&pool, deltaTime](int begin, int end, int) {
+                    PROFILE_SCOPE(PROFILE_JOB);
+                    pool.integrateRange(begin, end, deltaTime, GAME_LEFT, GAME_BOTTOM, GAME_RIGHT, GAME_TOP);
+                });
+            }
+        }
+        PROFILE_SCOPE(PROFILE_CULL);
+        pool.compact();
+    }
+
+    // Ǯ ϳ ڸ  ( ̾ ƽ  ).  θ ڸ  ʴ´.
+    //  ̸ ̹ ƽ    Ѿ ̵ Ÿ ش (ã  ׸ŭ ).
+    float buildHitGrid(UniformGrid& grid, const BulletPool& pool) {
+        if (runParallel(pool)) return 0;
+
+        bool swept = collisionMode == COLLISION_SWEPT;
+        float maxStepSq = 0;
+        grid.build(pool.count, [&](int i, float& x, float& y) {
+            x = pool.posX[i];
+            y = pool.posY[i];
+            if (swept) {
+                float dx = x - pool.prevX[i], dy = y - pool.prevY[i];
+                maxStepSq = std::max(maxStepSq, dx * dx + dy * dy);
+            }
+        });
+        return std::sqrt(maxStepSq);
+    }
+
+    // ڿ target ֺ    ܰ  ϰ,  ε  hits ´
+    // ̹ Ȱȭ Ѿ ǳʶٹǷ  Ѿ    ʴ´
+    void collectHits(const UniformGrid& grid, const BulletPool& pool, float maxStep,
+        const Transform& target, const Collider& collider) {
+        if (runParallel(pool)) {
+            collectHitsParallel(pool, target, collider);
+            return;
+        }
+
+        hits.clear();
+        float radius = collider.collisionRadius(pool.size);
+        float cx = target.position.x, cy = target.position.y, reach = radius;
+        if (collisionMode == COLLISION_SWEPT) {
+            // ڴ Ѿ  ġ Ƿ,  ̵  
+            //  +  ̵  + Ѿ ִ ̵ Ÿ ȿ ִ  
+            Vec2 move = target.position - target.prevPosition;
+            cx -= move.x * 0.5f;
+            cy -= move.y * 0.5f;
+            reach += move.length() * 0.5f + maxStep;
+        }
+        grid.query(cx, cy, reach, [&](int i) {
+            if (pool.active[i] && hitTest(pool, i, target, radius)) {
+                hits.push_back(i);
+            }
+        });
+        //  湮  ϰ     óѴ
+        std::sort(hits.begin(), hits.end());
+    }
+
+    // Ѿ  : ڸ   ûũ  ˻Ѵ.
+    //   ο Ƿ  յ , ûũ  ̾ ̸ ̹ ĵǾ ִ.
+    void collectHitsParallel(const BulletPool& pool, const Transform& target, const Collider& collider) {
+        int chunks = JobPool::chunkCount(pool.count, PARALLEL_CHUNK);
+        if ((int)chunkHits.size() < chunks) chunkHits.resize(chunks);
+
+        float radius = collider.collisionRadius(pool.size);
+        jobs->parallelFor(pool.count, PARALLEL_CHUNK, [&](int begin, int end, int chunk) {
+            PROFILE_SCOPE(PROFILE_JOB);
+            std::vector<int>& out = chunkHits[chunk];
+            out.clear();
+            for (int i = begin; i < end; i++) {
+                if (pool.active[i] && hitTest(pool, i, target, radius)) {
+                    out.push_back(i);
+                }
+            }
+        });
+
+        hits.clear();
+        for (int c = 0; c < chunks; c++) {
+            hits.insert(hits.end(), chunkHits[c].begin(), chunkHits[c].end());
+        }
+    }
+
+    //  ܰ  ϳ ( ο  ΰ   )
+    bool hitTest(const BulletPool& pool, int i, const Transform& target, float radius) const {
+        if (collisionMode == COLLISION_SWEPT) {
+            return sweptCirclesOverlap(pool.prevX[i], pool.prevY[i], pool.posX[i], pool.posY[i],
+                target.prevPosition.x, target.prevPosition.y, target.position.x, target.position.y, radius);
+        }
+        return circlesOverlap(pool.posX[i], pool.posY[i], target.position.x, target.position.y, radius);
+    }
+
+    //  ƽ Ѿ   ġ  
+    void savePreviousState() {
+        for (int i = 0; i < transforms.size(); i++) {
+            transforms[i].prevPosition = transforms[i].position;
+        }
+        attacks.savePrevious();
+        bullets.savePrevious();
+    }
+
+    // 浹 ܰ:  vs , Ѿ vs ÷̾ (  ܰ ü ϳ)
+    void updateCollisions() {
+        PROFILE_SCOPE(PROFILE_COLLISION);
+        // 浹 üũ:  vs 
+        if (!enemies.empty()) {
+            float maxStep = buildHitGrid(attackGrid, attacks);
+            for (int n = 0; n < enemies.size(); n++) {
+                Entity e = enemies.entity(n);
+                Health& health = healths.get(e);
+                collectHits(attackGrid, attacks, maxStep, transforms.get(e), colliders.get(e));
+                for (int i : hits) {
+                    if (health.value <= 0) break;
+                    damageEnemy(health, ATTACK_DAMAGE);
+                    particles.burst(attacks.posX[i], attacks.posY[i], HIT_SPARKS, PARTICLE_HIT,
+                        rng[RANDOM_PARTICLES]);
+                    attacks.active[i] = 0;
+                }
+                if (health.value <= 0) defeated.push_back(e);
+            }
+            for (Entity e : defeated) {
+                Vec2 p = transforms.get(e).position;
+                particles.burst(p.x, p.y, EXPLOSION_PARTICLES, PARTICLE_EXPLOSION, rng[RANDOM_PARTICLES]);
+                destroyEnemy(e);
+            }
+            defeated.clear();
+        }
+
+        // 浹 üũ: Ѿ vs ÷̾
+        float maxStep = buildHitGrid(bulletGrid, bullets);
+        for (int n = 0; n < players.size(); n++) {
+            Entity e = players.entity(n);
+            Collider& collider = colliders.get(e);
+            if (!collider.active) continue;
+            collectHits(bulletGrid, bullets, maxStep, transforms.get(e), collider);
+            for (int i : hits) {
+                if (!collider.active) break;
+                damagePlayer(players[n], collider);
+                particles.burst(bullets.posX[i], bullets.posY[i], PLAYER_HIT_SPARKS, PARTICLE_PLAYER_HIT,
+                    rng[RANDOM_PARTICLES]);
+                bullets.active[i] = 0;
+            }
+        }
+    }
+
+    void update(float deltaTime) {
+        savePreviousState();
+        clock.advance();
+        camera.update(deltaTime);
+        particles.update(deltaTime); //       ش
+
+        if (gameOver || gameWon) return;
+
+        // ƼƼ ý (   ȴ´)
+        updateMotion(deltaTime);
+        updateAnimation(deltaTime);
+        updatePlayers(deltaTime);
+        updateEnemies(deltaTime);
+
+        //  Ѿ ߻ (ϸ ڱ Ÿ̸ӷ)
+        updateEmitters(deltaTime);
+
+        //  Ʈ
+        updatePool(attacks, deltaTime);
+
+        // Ѿ Ʈ
+        updatePool(bullets, deltaTime);
+
+        updateCollisions();
+
+        //    üũ:  ÷̾   й,    ¸
+        bool anyLives = false;
+        for (int n = 0; n < players.size(); n++) {
+            if (players[n].lives > 0) anyLives = true;
+        }
+        if (!anyLives) {
+            gameOver = true;
+        }
+        if (enemies.empty()) {
+            gameWon = true;
+        }
+    }
+
+    // ġ  (Ȱ 浹ü  ִ)
+    void updateMotion(float deltaTime) {
+        for (int i = 0; i < velocities.size(); i++) {
+            Entity e = velocities.entity(i);
+            if (!colliders.get(e).active) continue;
+            Transform& t = transforms.get(e);
+            t.position = t.position + velocities[i].value * deltaTime;
+        }
+    }
+
+    void updateAnimation(float deltaTime) {
+        for (int i = 0; i < renderables.size(); i++) {
+            renderables[i].anim.advance(renderables[i].animSpeed, deltaTime);
+        }
+    }
+
+    // Ȱ   üũ
+    void updatePlayers(float deltaTime) {
+        for (int i = 0; i < players.size(); i++) {
+            PlayerState& player = players[i];
+            Entity e = players.entity(i);
+            Transform& t = transforms.get(e);
+
+            if (player.isRespawning) {
+                player.respawnTimer -= deltaTime;
+                if (player.respawnTimer <= 0) {
+                    player.isRespawning = false;
+                    colliders.get(e).active = true;
+                    t.position = player.spawn;
+                    t.prevPosition = t.position; // ̵  ʴ´
+                }
+                continue;
+            }
+
+            float size = colliders.get(e).size;
+            if (t.position.x - size < GAME_LEFT) t.position.x = GAME_LEFT + size;
+            if (t.position.x + size > GAME_RIGHT) t.position.x = GAME_RIGHT - size;
+            if (t.position.y - size < GAME_BOTTOM) t.position.y = GAME_BOTTOM + size;
+            if (t.position.y + size > GAME_TOP) t.position.y = GAME_TOP - size;
+        }
+    }
+
+    //  ¿ ̵ ϰ  ݻ
+    void updateEnemies(float deltaTime) {
+        for (int i = 0; i < enemies.size(); i++) {
+            Entity e = enemies.entity(i);
+            Transform& t = transforms.get(e);
+            Vec2& velocity = velocities.get(e).value;
+            float size = colliders.get(e).size;
+
+            enemies[i].move.advance(0.8f, deltaTime);
+            velocity.x = trigSin(enemies[i].move.signedRadians()) * 0.4f;
+
+            if (t.position.x - size < GAME_LEFT) {
+                t.position.x = GAME_LEFT + size;
+                velocity.x = std::abs(velocity.x);
+            }
+            if (t.position.x + size > GAME_RIGHT) {
+                t.position.x = GAME_RIGHT - size;
+                velocity.x = -std::abs(velocity.x);
+            }
+        }
+    }
+
+    // ߻⸶  ġ   ÷̾ ܴ
+    void updateEmitters(float deltaTime) {
+        for (int i = 0; i < emitters.size(); i++) {
+            Emitter& emitter = emitters[i];
+            Vec2 origin = transforms.get(emitter.owner).position;
+            Vec2 target = nearestPlayer(origin);
+            updateEmitter(patterns[emitter.state.pattern], emitter.state, bullets, rng[RANDOM_PATTERNS], deltaTime,
+                origin.x, origin.y, target.x, target.y);
+        }
+    }
+
+    Vec2 nearestPlayer(Vec2 from) const {
+        Vec2 best = from;
+        float bestDistance = 0;
+        for (int i = 0; i < players.size(); i++) {
+            Vec2 p = transforms.get(players.entity(i)).position;
+            Vec2 d = p - from;
+            float distance = d.x * d.x + d.y * d.y;
+            if (i == 0 || distance < bestDistance) {
+                best = p;
+                bestDistance = distance;
+            }
+        }
+        return best;
+    }
+
+    void damagePlayer(PlayerState& player, Collider& collider) {
+        if (!collider.active || player.isRespawning) return;
+
+        player.lives--;
+        camera.add(0.5f); // ǰ  ȭ 鸲
+        if (player.lives > 0) {
+            collider.active = false;
+            player.isRespawning = true;
+            player.respawnTimer = RESPAWN_TIME;
+        }
+    }
+
+    void damageEnemy(Health& health, float damage) {
+        health.value -= damage;
+        camera.add(0.3f); //  ǰ ÿ ȭ 鸲
+        if (health.value <= 0) {
+            camera.add(1.0f); //  ı   ȭ 鸲
+        }
+    }
+
+    // ׸ GL (assn1.cpp) Ѵ
+    // alpha  ƽ  ƽ   
+    void render(float alpha);
+
+    // ӵ  ȸ   Ѿ 
+    void spawnBullet(Vec2 pos, Vec2 vel) {
+        bullets.spawn(pos.x, pos.y, vel.x, vel.y, trigAtan2(vel.y, vel.x));
+    }
+
+    void shootAttack(int slot = 0) {
+        Entity e = playerEntity(slot);
+        if (e == NO_ENTITY) return;
+        if (colliders.get(e).active && !players.get(e).isRespawning) {
+            //   ̵
+            Vec2 position = transforms.get(e).position;
+            attacks.spawn(position.x, position.y, 0, ATTACK_SPEED, 0);
+        }
+    }
+
+    // input INPUT_* Ʈ  (Ű ũƮ  η ´)
+    // slot ° ÷̾ δ
+    void handleInput(unsigned int input, int slot = 0) {
+        Entity e = playerEntity(slot);
+        if (e == NO_ENTITY) return;
+        Vec2& velocity = velocities.get(e).value;
+        float moveSpeed = 1.2f;
+
+        // ÷̾ ̵ ó
+        if (input & INPUT_UP) {
+            velocity.y = moveSpeed;
+        }
+        else if (input & INPUT_DOWN) {
+            velocity.y = -moveSpeed;
+        }
+        else {
+            velocity.y = 0.0f;
+        }
+
+        if (input & INPUT_LEFT) {
+            velocity.x = -moveSpeed;
+        }
+        else if (input & INPUT_RIGHT) {
+            velocity.x = moveSpeed;
+        }
+        else {
+            velocity.x = 0.0f;
+        }
+
+        if (input & INPUT_FIRE) {
+            shootAttack(slot);
+        }
+    }
+
+    // ùķ̼  ü  ؽ ( Ȯο)
+    uint64_t stateHash() const {
+        StateHasher h;
+        h.add(seed);
+        for (int i = 0; i < RANDOM_STREAM_COUNT; i++) h.add(rng[i].counter);
+        h.add(clock.ticks);
+        h.add(gameOver);
+        h.add(gameWon);
+        h.add(camera.shake);
+        for (int i = 0; i < players.size(); i++) {
+            Entity e = players.entity(i);
+            const Transform& t = transforms.get(e);
+            h.add(t.position.x);
+            h.add(t.position.y);
+            h.add(players[i].lives);
+            h.add(players[i].respawnTimer);
+            h.add(colliders.get(e).active);
+        }
+        for (int i = 0; i < enemies.size(); i++) {
+            Entity e = enemies.entity(i);
+            const Transform& t = transforms.get(e);
+            h.add(t.position.x);
+            h.add(t.position.y);
+            h.add(healths.get(e).value);
+            for (int k = 0; k < emitters.size(); k++) {
+                if (emitters[k].owner != e) continue;
+                h.add(emitters[k].state.timer);
+                h.add(emitters[k].state.angle.raw());
+                h.add(emitters[k].state.phase.raw());
+            }
+            h.add(colliders.get(e).active);
+        }
+        h.addPool(attacks);
+        h.addPool(bullets);
+        return h.value;
+    }
+
+    //  (snapshot.h): ùķ̼ ¸ (, 浹 , ۾ Ǯ   ƽ  ӽ ۴ )
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar.value(seed);
+        ar.array(rng, RANDOM_STREAM_COUNT);
+        ar.value(clock);
+        ar.value(gameOver);
+        ar.value(gameWon);
+        ar.value(camera);
+        entities.serialize(ar);
+        transforms.serialize(ar);
+        velocities.serialize(ar);
+        colliders.serialize(ar);
+        healths.serialize(ar);
+        renderables.serialize(ar);
+        players.serialize(ar);
+        enemies.serialize(ar);
+        emitters.serialize(ar);
+        attacks.serialize(ar);
+        bullets.serialize(ar);
+    }
+
+private:
+    void addEmitters(Entity owner) {
+        for (int i = 0; i < (int)patterns.size(); i++) {
+            Entity e = entities.create();
+            emitters.add(e, Emitter(owner, i));
+        }
+    }
+
+    void seedRandom() {
+        for (int i = 0; i < RANDOM_STREAM_COUNT; i++) rng[i] = randomStream(seed, (uint32_t)i);
+    }
+
+    void clearWorld() {
+        entities.clear();
+        transforms.clear();
+        velocities.clear();
+        colliders.clear();
+        healths.clear();
+        renderables.clear();
+        players.clear();
+        enemies.clear();
+        emitters.clear();
+    }
+
+    // ÷̾ Ʒʿ η,   ݿ ڷ þ´ (ϳ̸  ڸ)
+    //  ̸ ¿ ̵  õ忡    Ȱ  ʰ Ѵ
+    void spawnWorld() {
+        for (int i = 0; i < playerCount; i++) {
+            spawnPlayer(Vec2((i - (playerCount - 1) * 0.5f) * 0.3f, -0.7f));
+        }
+        int cols = std::max(1, std::min(enemyCount, 12));
+        int rows = (enemyCount + cols - 1) / cols;
+        for (int i = 0; i < enemyCount; i++) {
+            if (enemyCount == 1) {
+                spawnEnemy(Vec2(0, 0.6f));
+                continue;
+            }
+            float x = cols > 1 ? -0.85f + 1.7f * (i % cols) / (cols - 1) : 0.0f;
+            float y = rows > 1 ? 0.85f - 0.75f * (i / cols) / (rows - 1) : 0.6f;
+            Entity e = spawnEnemy(Vec2(x, y));
+            enemies.get(e).move.advanceRadians(rng[RANDOM_ENEMY_AI].range(0, 6.28318531f));
+        }
+    }
+};
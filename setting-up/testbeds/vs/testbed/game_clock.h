@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+// ùķ̼ ð  
+//  Ŀ float (gameTime, ִϸ̼ Ÿ̸)  ð  ȿ ڸ ڶ
+// sin(t * k)   ó . 
+//   GameClock   ƽ  64Ʈ   (ʰ ʿ  double  ٲ۴)
+//   Phase      ֱ   32Ʈ Ҽ Ѵ. 2^32   (2)
+//               ġ   ֱ ǰ̰, е( 1.5e-9 rad)  ̿ ϴ.
+//
+//   anim.advance(3.0f, deltaTime);          // ʴ 3 rad
+//   float s = trigSin(anim.signedRadians());
+
+struct GameClock {
+    uint64_t ticks;
+
+    GameClock() : ticks(0) {}
+
+    void advance() { ticks++; }
+
+    double seconds(double tickSeconds) const { return ticks * tickSeconds; }
+};
+
+class Phase {
+public:
+    Phase() : turn(0) {}
+
+    // ʴ radiansPerSecond  deltaTime ŭ  ( Ųٷ)
+    void advance(float radiansPerSecond, float deltaTime) {
+        advanceRadians((double)radiansPerSecond * deltaTime);
+    }
+
+    void advanceRadians(double radians) {
+        turn += toTurn(radians);
+    }
+
+    // [0, 2)
+    float radians() const { return (float)(turn * RADIANS_PER_UNIT); }
+
+    // [-, ) - ﰢԼ ٻ簡  Ȯ 
+    float signedRadians() const { return (float)((int32_t)turn * RADIANS_PER_UNIT); }
+
+    uint32_t raw() const { return turn; }
+
+private:
+    static constexpr double UNITS_PER_TURN = 4294967296.0; // 2^32
+    static constexpr double RADIANS_PER_UNIT = 6.283185307179586 / UNITS_PER_TURN;
+
+    uint32_t turn; //   2^32  1 
+
+    static uint32_t toTurn(double radians) {
+        double units = std::fmod(radians / RADIANS_PER_UNIT, UNITS_PER_TURN);
+        return (uint32_t)(int64_t)std::llround(units); //  2  ǰ
+    }
+};
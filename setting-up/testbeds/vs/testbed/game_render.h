@@ -0,0 +1,436 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "game.h"
+#include "renderer.h"
+#include "core_renderer.h"
+#include "profiler.h"
+#include "frame_arena.h"
+#ifndef M_PI
+# define M_PI 	   3.14159265358979323846  /* pi */
+#endif
+
+//  ȭ ׸ (assn1.cpp  bench_render.cpp   )
+// initVBOs()   VBO ĳ ޽ø   renderer->init  ѱ,
+// Game::render   renderer    ׸ ( ü ȣ ʿ).
+
+// VBO ȭ  
+inline GLuint circleVBO = 0;
+inline GLuint bulletVBO = 0;
+inline GLuint starVBO = 0;
+inline GLuint sparkVBO = 0;
+inline bool vbosInitialized = false;
+const int CIRCLE_SEGMENTS = 32;
+const int CIRCLE_VERTICES = CIRCLE_SEGMENTS + 2;
+const int BULLET_VERTICES = 18;
+const int STAR_VERTICES = 12; // ߽ +  10 + ݴ 
+const int SPARK_VERTICES = 4;  //  (+x)  
+
+//  ӽ ޸ ( ۸ )
+inline FrameArena frameArena;
+inline ArenaResource frameScratch(frameArena);
+
+// ׸ 鿣 (⺻ ȣȯ , --core  ھ )
+inline LegacyRenderer legacyRenderer;
+inline CoreRenderer coreRenderer;
+inline Renderer* renderer = &legacyRenderer;
+
+//  ĳ ޽
+inline MeshCache meshCache;
+inline int playerMesh = 0;
+inline int enemyMesh = 0;
+inline int enemyLeftArmMesh = 0;
+inline int enemyRightArmMesh = 0;
+
+inline void bakePlayer();
+inline void bakeEnemy();
+
+// VBO ʱȭ Լ
+inline void initVBOs() {
+    if (vbosInitialized) return;
+
+    //  VBO ʱȭ
+    std::pmr::vector<float> circleVertices(&frameScratch);
+    circleVertices.push_back(0.0f); // ߽
+    circleVertices.push_back(0.0f);
+
+    for (int i = 0; i <= CIRCLE_SEGMENTS; i++) {
+        float angle = i * 2.0f * M_PI / CIRCLE_SEGMENTS;
+        circleVertices.push_back(cos(angle));
+        circleVertices.push_back(sin(angle));
+    }
+
+    glGenBuffers(1, &circleVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, circleVBO);
+    glBufferData(GL_ARRAY_BUFFER, circleVertices.size() * sizeof(float),
+        circleVertices.data(), GL_STATIC_DRAW);
+
+    // Ѿ  VBO ʱȭ (Ÿ)
+    std::pmr::vector<float> bulletVertices(&frameScratch);
+    bulletVertices.push_back(0.0f); // ߽
+    bulletVertices.push_back(0.0f);
+
+    for (int i = 0; i <= 16; i++) {
+        float angle = i * 2.0f * M_PI / 16;
+        bulletVertices.push_back(cos(angle) * 0.6f); // x 
+        bulletVertices.push_back(sin(angle) * 1.2f); // y Ȯ
+    }
+
+    glGenBuffers(1, &bulletVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, bulletVBO);
+    glBufferData(GL_ARRAY_BUFFER, bulletVertices.size() * sizeof(float),
+        bulletVertices.data(), GL_STATIC_DRAW);
+
+    //   VBO ʱȭ (ٱ/   θ ﰢ )
+    std::pmr::vector<float> starVertices(&frameScratch);
+    starVertices.push_back(0.0f); // ߽
+    starVertices.push_back(0.0f);
+
+    for (int i = 0; i <= 10; i++) {
+        float angle = i * M_PI / 5;
+        float radius = (i % 2 == 0) ? 1.0f : 0.4f;
+        starVertices.push_back(cos(angle) * radius);
+        starVertices.push_back(sin(angle) * radius);
+    }
+
+    glGenBuffers(1, &starVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, starVBO);
+    glBufferData(GL_ARRAY_BUFFER, starVertices.size() * sizeof(float),
+        starVertices.data(), GL_STATIC_DRAW);
+
+    // Ҳ  VBO ʱȭ (ƼŬ)
+    const float sparkVertices[SPARK_VERTICES * 2] = {
+        1.0f, 0.0f, 0.0f, 0.3f, -1.0f, 0.0f, 0.0f, -0.3f
+    };
+
+    glGenBuffers(1, &sparkVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, sparkVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(sparkVertices), sparkVertices, GL_STATIC_DRAW);
+
+    // ĳ ޽
+    bakePlayer();
+    bakeEnemy();
+    meshCache.upload();
+    frameArena.reset(); //   GPU ÷Ƿ 
+
+    vbosInitialized = true;
+}
+
+//  ʱȭ ѱ ޽  (initVBOs ڿ)
+inline RenderMeshes renderMeshes() {
+    RenderMeshes meshes = { circleVBO, CIRCLE_VERTICES, bulletVBO, BULLET_VERTICES,
+        starVBO, STAR_VERTICES, sparkVBO, SPARK_VERTICES, &meshCache };
+    return meshes;
+}
+
+inline void cleanupVBOs() {
+    if (!vbosInitialized) return;
+    glDeleteBuffers(1, &circleVBO);
+    glDeleteBuffers(1, &bulletVBO);
+    glDeleteBuffers(1, &starVBO);
+    glDeleteBuffers(1, &sparkVBO);
+    renderer->cleanup();
+    meshCache.cleanup();
+    vbosInitialized = false;
+}
+
+// ĳ ޽  (   )
+//    ׸   ׾Ƽ ġ  ״ ȴ
+inline void bakePlayer() {
+    float size = PLAYER_SIZE;
+    playerMesh = meshCache.begin();
+
+    // ü (巹)
+    meshCache.color(0.2f, 0.2f, 0.2f);
+    float dress[17 * 2];
+    for (int i = 0; i <= 16; i++) {
+        float angle = M_PI + i * M_PI / 16;
+        dress[i * 2] = cos(angle) * size * 0.6f;
+        dress[i * 2 + 1] = -size * 0.3f + sin(angle) * size * 0.4f;
+    }
+    meshCache.fan(0, -size * 0.3f, dress, 17);
+
+    // ü (ġ)
+    meshCache.color(0.9f, 0.9f, 0.9f);
+    meshCache.quad(-size * 0.3f, size * 0.1f, size * 0.3f, size * 0.1f,
+        size * 0.3f, -size * 0.2f, -size * 0.3f, -size * 0.2f);
+
+    // 
+    meshCache.color(1.0f, 0.9f, 0.8f);
+    meshCache.circle(-size * 0.4f, 0, size * 0.15f, CIRCLE_SEGMENTS);
+    meshCache.circle(size * 0.4f, 0, size * 0.15f, CIRCLE_SEGMENTS);
+
+    // Ӹ
+    meshCache.circle(0, size * 0.4f, size * 0.3f, CIRCLE_SEGMENTS);
+
+    // Ӹī (ũ)
+    meshCache.color(1.0f, 0.7f, 0.8f);
+    meshCache.circle(-size * 0.15f, size * 0.5f, size * 0.2f, CIRCLE_SEGMENTS);
+    meshCache.circle(size * 0.15f, size * 0.5f, size * 0.2f, CIRCLE_SEGMENTS);
+    meshCache.circle(0, size * 0.6f, size * 0.25f, CIRCLE_SEGMENTS);
+
+    // 
+    meshCache.color(0.0f, 0.0f, 0.0f);
+    meshCache.circle(-size * 0.1f, size * 0.45f, size * 0.05f, CIRCLE_SEGMENTS);
+    meshCache.circle(size * 0.1f, size * 0.45f, size * 0.05f, CIRCLE_SEGMENTS);
+
+    //  ̶Ʈ
+    meshCache.color(1.0f, 1.0f, 1.0f);
+    meshCache.circle(-size * 0.08f, size * 0.47f, size * 0.02f, CIRCLE_SEGMENTS);
+    meshCache.circle(size * 0.12f, size * 0.47f, size * 0.02f, CIRCLE_SEGMENTS);
+
+    // 巹 ()
+    meshCache.color(1.0f, 0.6f, 0.7f);
+    meshCache.triangle(-size * 0.2f, size * 0.7f, -size * 0.05f, size * 0.8f, -size * 0.1f, size * 0.6f);
+    meshCache.triangle(size * 0.2f, size * 0.7f, size * 0.05f, size * 0.8f, size * 0.1f, size * 0.6f);
+
+    meshCache.end();
+}
+
+inline void bakeEnemy() {
+    float size = ENEMY_SIZE;
+    enemyMesh = meshCache.begin();
+
+    // ũ ٴ (÷Ʈ)
+    meshCache.color(0.8f, 0.8f, 0.9f);
+    meshCache.circle(0, -size * 0.8f, size * 0.9f, CIRCLE_SEGMENTS);
+
+    // ũ
+    meshCache.color(1.0f, 0.85f, 0.4f);
+    meshCache.circle(0, -size * 0.6f, size * 0.7f, CIRCLE_SEGMENTS);
+
+    // ũ  ̶Ʈ
+    meshCache.color(1.0f, 0.9f, 0.6f);
+    meshCache.circle(-size * 0.2f, -size * 0.55f, size * 0.15f, CIRCLE_SEGMENTS);
+
+    // ĳ ü
+    meshCache.color(1.0f, 0.9f, 0.8f);
+    meshCache.circle(0, -size * 0.2f, size * 0.25f, CIRCLE_SEGMENTS);
+
+    // Ӹ
+    meshCache.circle(0, size * 0.1f, size * 0.3f, CIRCLE_SEGMENTS);
+
+    // Ӹī ()
+    meshCache.color(0.8f, 0.6f, 0.4f);
+    meshCache.circle(-size * 0.2f, size * 0.2f, size * 0.2f, CIRCLE_SEGMENTS);
+    meshCache.circle(size * 0.2f, size * 0.2f, size * 0.2f, CIRCLE_SEGMENTS);
+    meshCache.circle(0, size * 0.3f, size * 0.25f, CIRCLE_SEGMENTS);
+
+    //  ( ǥ)
+    meshCache.color(0.0f, 0.0f, 0.0f);
+    meshCache.quad(-size * 0.15f, size * 0.12f, -size * 0.05f, size * 0.12f,
+        -size * 0.05f, size * 0.08f, -size * 0.15f, size * 0.08f);
+    meshCache.quad(size * 0.15f, size * 0.12f, size * 0.05f, size * 0.12f,
+        size * 0.05f, size * 0.08f, size * 0.15f, size * 0.08f);
+
+    //  ( )
+    meshCache.color(0.8f, 0.4f, 0.4f);
+    meshCache.circle(0, size * 0.02f, size * 0.03f, CIRCLE_SEGMENTS);
+
+    meshCache.end();
+
+    //  (۰): Ʒ 鸮Ƿ  ´
+    meshCache.color(1.0f, 0.9f, 0.8f);
+    enemyLeftArmMesh = meshCache.begin();
+    meshCache.circle(-size * 0.35f, -size * 0.1f, size * 0.12f, CIRCLE_SEGMENTS);
+    meshCache.end();
+    enemyRightArmMesh = meshCache.begin();
+    meshCache.circle(size * 0.35f, -size * 0.1f, size * 0.12f, CIRCLE_SEGMENTS);
+    meshCache.end();
+}
+
+// ÷̾ ׸ (Ȱ  ߿  ڸ ׸)
+inline void drawPlayer(Vec2 pos) {
+    renderer->drawMesh(playerMesh, pos.x, pos.y);
+}
+
+//  ׸ (Ķ  )
+inline void drawAttack(float x, float y, float rotation) {
+    float size = ATTACK_SIZE;
+
+    //      ( VBO νϽ ׸)
+    renderer->color(0.3f, 0.7f, 1.0f);
+    renderer->star(x, y, size, rotation);
+
+    // ߽ 
+    renderer->color(1.0f, 1.0f, 1.0f);
+    renderer->circle(x, y, size * 0.3f);
+}
+
+//  Ѿ ׸ ( Ÿ)
+// Ѿ Ƿ   νϽ ۿ ٷ 
+inline void writeEnemyBullet(SpriteInstance& body, SpriteInstance& highlight, float x, float y, float rotation) {
+    //  Ѿ˴ٿ  Ÿ
+    SpriteInstance bodyInst = { x, y, BULLET_SIZE, rotation, 1.0f, 0.3f, 0.3f };
+    body = bodyInst;
+
+    // ߽ ̶Ʈ
+    SpriteInstance highlightInst = { x, y, BULLET_SIZE * 0.4f, 0, 1.0f, 0.8f, 0.8f };
+    highlight = highlightInst;
+}
+
+// ƼŬ ׸:  ִ   νϽ ۿ  ο    ׸.
+//   ,  ټ ۾   ٲ.
+// ƽ  ġ  ġ   ʰ ӵ Ž ö Ѵ.
+inline void drawParticles(const ParticleSystem& particles, float alpha) {
+    if (particles.size() == 0) return;
+    SpriteInstance* sparks = renderer->mapSprites(SPRITE_SPARK, particles.size());
+    float back = (1.0f - alpha) * SIM_DT;
+    int sparkCount = 0;
+    for (int k = 0; k < particles.size(); k++) {
+        int i = particles.slot(k);
+        if (particles.life[i] <= 0) continue;
+        const ParticleStyle& s = particles.styles[particles.style[i]];
+        float t = std::min(1.0f, particles.life[i] * particles.fade[i]);
+        float vx = particles.velX[i], vy = particles.velY[i];
+        SpriteInstance inst = { particles.posX[i] - vx * back, particles.posY[i] - vy * back, s.size * t,
+            trigAtan2(vy, vx), s.r1 + (s.r0 - s.r1) * t, s.g1 + (s.g0 - s.g1) * t, s.b1 + (s.b0 - s.b1) * t };
+        sparks[sparkCount++] = inst;
+    }
+    renderer->commitSprites(SPRITE_SPARK, sparkCount);
+}
+
+//  ׸
+inline void drawEnemy(Vec2 pos, const Phase& anim) {
+    float armBob = trigSin(anim.signedRadians()) * 0.05f;
+    renderer->drawMesh(enemyMesh, pos.x, pos.y);
+    renderer->drawMesh(enemyLeftArmMesh, pos.x, pos.y + armBob);
+    renderer->drawMesh(enemyRightArmMesh, pos.x, pos.y - armBob);
+}
+
+//  ȭ ü ׸
+inline void Game::render(float alpha) {
+    renderer->beginFrame(camera.offset.x, camera.offset.y);
+
+    //  Ʈ  (Renderable 迭   ȴ´)
+    for (int i = 0; i < renderables.size(); i++) {
+        const Renderable& r = renderables[i];
+        Vec2 pos = transforms.get(renderables.entity(i)).renderPosition(alpha);
+        if (r.kind == RENDER_PLAYER) {
+            drawPlayer(pos);
+        }
+        else {
+            drawEnemy(pos, r.anim);
+        }
+    }
+
+    for (int i = 0; i < attacks.count; i++) {
+        if (!attacks.active[i]) continue;
+        float x = attacks.prevX[i] + (attacks.posX[i] - attacks.prevX[i]) * alpha;
+        float y = attacks.prevY[i] + (attacks.posY[i] - attacks.prevY[i]) * alpha;
+        drawAttack(x, y, attacks.rotation[i]);
+    }
+
+    SpriteInstance* bodies = renderer->mapSprites(SPRITE_BULLET, bullets.count);
+    SpriteInstance* highlights = renderer->mapSprites(SPRITE_CIRCLE, bullets.count);
+    int bulletCount = 0;
+    for (int i = 0; i < bullets.count; i++) {
+        if (!bullets.active[i]) continue;
+        float x = bullets.prevX[i] + (bullets.posX[i] - bullets.prevX[i]) * alpha;
+        float y = bullets.prevY[i] + (bullets.posY[i] - bullets.prevY[i]) * alpha;
+        writeEnemyBullet(bodies[bulletCount], highlights[bulletCount], x, y, bullets.rotation[i]);
+        bulletCount++;
+    }
+    renderer->commitSprites(SPRITE_BULLET, bulletCount);
+    renderer->commitSprites(SPRITE_CIRCLE, bulletCount);
+    drawParticles(particles, alpha);
+    renderer->flush();
+
+    // UI  (ī޶ ȯ   )
+    renderer->beginUI();
+
+    //  ǥ (ù ° ÷̾)
+    int lives = players.empty() ? 0 : players[0].lives;
+    for (int i = 0; i < lives; i++) {
+        renderer->color(0.0f, 1.0f, 0.0f);
+        renderer->circle(-0.9f + i * 0.1f, 0.9f, 0.03f);
+    }
+    renderer->flush();
+
+    //  ü  (  ü ü )
+    if (!healths.empty()) {
+        float total = 0, maxTotal = 0;
+        for (int i = 0; i < healths.size(); i++) {
+            total += healths[i].value;
+            maxTotal += healths[i].max;
+        }
+        float healthRatio = total / maxTotal;
+
+        // ü¹ 
+        renderer->color(0.3f, 0.3f, 0.3f);
+        renderer->rect(-0.5f, 0.8f, 0.5f, 0.85f);
+
+        // ü¹
+        renderer->color(1.0f - healthRatio, healthRatio, 0.0f);
+        renderer->rect(-0.5f, 0.8f, -0.5f + healthRatio, 0.85f);
+    }
+
+    //  /¸ ޽
+    if (gameOver) {
+        renderer->color(1.0f, 0.0f, 0.0f);
+        renderer->rect(-0.6f, -0.1f, 0.6f, 0.1f);
+    }
+    else if (gameWon) {
+        renderer->color(0.0f, 1.0f, 0.0f);
+        renderer->rect(-0.6f, -0.1f, 0.6f, 0.1f);
+    }
+    renderer->flush();
+}
+
+//  ð HUD (ȭ  Ʒ,    ֱ )
+// ȸ 밡  ü ̰,   update(ʷ)/render(Ķ)/swap() ״´.
+// update  ȿ  Ϻ collision(Ȳ)/cull() Ʒ  ׸.
+//   16.7ms (60Hz) .
+const int HUD_FRAMES = 120;
+const float HUD_LEFT = -0.98f;
+const float HUD_BOTTOM = -0.98f;
+const float HUD_BAR_WIDTH = 0.005f;
+const float HUD_HEIGHT_PER_MS = 0.3f / 33.3f; // 33.3ms  HUD 
+
+inline void drawProfilerHud(const std::pmr::vector<ProfileFrame>& frames) {
+    const float right = HUD_LEFT + HUD_FRAMES * HUD_BAR_WIDTH;
+    renderer->color(0.0f, 0.0f, 0.0f);
+    renderer->rect(HUD_LEFT, HUD_BOTTOM, right, HUD_BOTTOM + 33.3f * HUD_HEIGHT_PER_MS);
+
+    const int stacked[] = { PROFILE_UPDATE, PROFILE_RENDER, PROFILE_SWAP };
+    const float colors[][3] = { { 0.2f, 0.8f, 0.2f }, { 0.3f, 0.5f, 1.0f }, { 1.0f, 0.9f, 0.2f } };
+    const int nested[] = { PROFILE_COLLISION, PROFILE_CULL };
+    const float nestedColors[][3] = { { 1.0f, 0.5f, 0.1f }, { 0.7f, 0.3f, 0.9f } };
+
+    int first = std::max(0, (int)frames.size() - HUD_FRAMES);
+    for (int i = first; i < (int)frames.size(); i++) {
+        const ProfileFrame& pf = frames[i];
+        float x = right - (frames.size() - i) * HUD_BAR_WIDTH;
+        float top = std::min(pf.frameMs, 33.3) * HUD_HEIGHT_PER_MS;
+        renderer->color(0.35f, 0.35f, 0.35f);
+        renderer->rect(x, HUD_BOTTOM, x + HUD_BAR_WIDTH, HUD_BOTTOM + top);
+
+        float y = HUD_BOTTOM;
+        for (int s = 0; s < 3; s++) {
+            float height = (float)pf.scopeMs[stacked[s]] * HUD_HEIGHT_PER_MS;
+            if (height <= 0) continue;
+            height = std::min(height, HUD_BOTTOM + 33.3f * HUD_HEIGHT_PER_MS - y);
+            renderer->color(colors[s][0], colors[s][1], colors[s][2]);
+            renderer->rect(x, y, x + HUD_BAR_WIDTH, y + height);
+            if (stacked[s] == PROFILE_UPDATE) {
+                float inner = y;
+                for (int k = 0; k < 2; k++) {
+                    float h = std::min((float)pf.scopeMs[nested[k]] * HUD_HEIGHT_PER_MS, y + height - inner);
+                    if (h <= 0) continue;
+                    renderer->color(nestedColors[k][0], nestedColors[k][1], nestedColors[k][2]);
+                    renderer->rect(x, inner, x + HUD_BAR_WIDTH, inner + h);
+                    inner += h;
+                }
+            }
+            y += height;
+        }
+    }
+
+    renderer->color(1.0f, 0.2f, 0.2f);
+    float line = HUD_BOTTOM + 16.7f * HUD_HEIGHT_PER_MS;
+    renderer->rect(HUD_LEFT, line, right, line + 0.003f);
+    renderer->flush();
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// glm . glm    ٸ glm     Ѵ.
+// GLM_ARCH  glm  ó Ե  Ƿ,  ̶    ԵǸ
+//    ü SIMD (glm/simd/*.h) SSE2/AVX2 ΰ .
+// Ϸ ɼ(/arch:AVX2, -mavx2 )  AVX2 / SSE2 / Į ΰ .
+#ifndef GLM_FORCE_INTRINSICS
+#define GLM_FORCE_INTRINSICS
+#endif
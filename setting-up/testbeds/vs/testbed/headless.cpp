@@ -0,0 +1,392 @@
+// â   ùķ̼Ǹ   
+// GPU ÷̰  CI ӽſ  ׽Ʈ  Ȯο .
+// : cl headless.cpp /O2 /EHsc /std:c++17 /I ..\include
+//
+// : headless [--ticks N] [--dt ] [--seed N] [--script ] [--runs N] [--jobs N] [--stress N]
+//                [--patterns ] [--count-allocs] [--swept] [--enemies N] [--record ] [--replay ]
+//                [--rollback N]
+//   --patterns   ź   (patterns.txt ,  ⺻ ä)
+//   --count-allocs   Է reset  ̿ ΰ    ƽ  Ҵ .
+//                    ° ( ) Ҵ ϳ   ڵ 1
+//   --jobs N    ùķ̼  ۾ Ǯ   (0̸  , ؽô ƾ Ѵ)
+//   --stress N   ƽ  Ѿ N ä ִ  ׽Ʈ
+//   --record   ù  Է ÷̷  (replay.h)
+//   --replay   ÷̸ ִ ӵ ٽ . õ, ƽ ,  , 浹 , ƽ 
+//                  ÷̸ ,   ؽð ȭ  ٸ  ڵ 1
+//                  ( ȭ    --patterns  Ѱܾ Ѵ)
+//   --rollback N  ѹ ڵ 䳻:  ƽ   N ƽ  ǵ ٽ Ѵ
+//                 ( Է  N ƽ ʰ  ). ؽô ǵ   ƾ ϰ,
+//                 /ѹ ð ũ⸦ Ѵ (snapshot.h)
+//
+// ũƮ   script.h 
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+// ̺Ʈ д (HUD, CSV) Ƿ ƽ ð  ʵ    Ѵ
+#define PROFILER_ENABLED 0
+#include "game.h"
+#include "replay.h"
+#include "snapshot.h"
+#include "script.h"
+
+// --count-allocs :   operator new ȣ  (new[]   ´)
+std::atomic<long long> allocationCount(0);
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+//  operator new  malloc   ޸𸮶 free  ¦ ´. GCC  delete  ζ 
+// new   ͸ free Ѵٰ  -Wmismatched-new-delete  Ƿ ⼭ .
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+struct RunConfig {
+    int ticks = 3600;
+    float deltaTime = SIM_DT;
+    unsigned int seed = 0;
+    int runs = 1;
+    int jobs = 0;
+    int stress = 0;
+    std::string scriptPath;
+    std::string patternPath;
+    bool countAllocs = false;
+    CollisionMode collisionMode = COLLISION_DISCRETE;
+    int enemies = 1;
+    std::string recordPath;
+    std::string replayPath;
+    int rollback = 0;
+};
+
+//  ׽Ʈ: ȭ   Ѿ target  ä
+void fillStressBullets(Game& game, int target, int& serial) {
+    while (game.bullets.count < target) {
+        int i = serial++;
+        float y = -0.2f + (i % 1000) * 0.00115f;
+        float speed = 0.3f + (i % 7) * 0.1f;
+        game.spawnBullet(Vec2(GAME_LEFT, y), Vec2(speed, (i % 3 - 1) * 0.05f));
+    }
+}
+
+// ũƮ(Ǵ ÷)   ƽ Ѵ
+struct ScriptPlayer {
+    const RunConfig& config;
+    const std::vector<ScriptEntry>& script;
+    size_t next;
+    unsigned int input;
+    int serial;
+    ReplayCursor* replay;      //  ũƮ  ÷ Է
+    ReplayRecorder* recorder;  //   Է ȭ
+
+    ScriptPlayer(const RunConfig& config, const std::vector<ScriptEntry>& script,
+        ReplayCursor* replay = nullptr, ReplayRecorder* recorder = nullptr)
+        : config(config), script(script), next(0), input(0), serial(0), replay(replay), recorder(recorder) {}
+
+    void step(Game& game, int tick) {
+        if (replay) {
+            input = replay->next();
+        }
+        else {
+            while (next < script.size() && script[next].tick <= tick) {
+                input = script[next++].input;
+            }
+        }
+        if (recorder) recorder->record(input);
+        apply(game, input);
+    }
+
+    // Է ϳ  ƽ  (ѹ  ٽ   )
+    void apply(Game& game, unsigned int tickInput) {
+        if (tickInput & REPLAY_RESET) game.reset(game.seed);
+        if (config.stress > 0) fillStressBullets(game, config.stress, serial);
+        game.handleInput(tickInput & ~REPLAY_RESET);
+        game.update(config.deltaTime);
+    }
+};
+
+// ùķ̼       ؽø ش
+// replay   ũƮ   Է, recorder    Է ȭѴ
+uint64_t runSimulation(const RunConfig& config, const std::vector<ScriptEntry>& script,
+    const std::vector<PatternDef>& patterns, JobPool* jobs,
+    const Replay* replay = nullptr, ReplayRecorder* recorder = nullptr) {
+    Game game(config.seed, jobs);
+    game.setPatterns(patterns);
+    game.collisionMode = config.collisionMode;
+    game.enemyCount = config.enemies;
+    game.reset(config.seed);
+
+    std::unique_ptr<ReplayCursor> cursor;
+    if (replay) cursor.reset(new ReplayCursor(*replay));
+    if (recorder) recorder->begin(game, config.deltaTime);
+
+    ScriptPlayer player(config, script, cursor.get(), recorder);
+    for (int tick = 0; tick < config.ticks; tick++) {
+        player.step(game, tick);
+    }
+    if (recorder) recorder->finish(game);
+    return game.stateHash();
+}
+
+//  ƽ   config.rollback ƽ  ǵ ٽ ϸ  
+// ƽ Է°  Ѿ ȣ  ξٰ ٽ   ״ ִ´
+uint64_t runRollback(const RunConfig& config, const std::vector<ScriptEntry>& script,
+    const std::vector<PatternDef>& patterns, JobPool* jobs, const Replay* replay) {
+    Game game(config.seed, jobs);
+    game.setPatterns(patterns);
+    game.collisionMode = config.collisionMode;
+    game.enemyCount = config.enemies;
+    game.reset(config.seed);
+
+    std::unique_ptr<ReplayCursor> cursor;
+    if (replay) cursor.reset(new ReplayCursor(*replay));
+    ScriptPlayer player(config, script, cursor.get());
+
+    RollbackHistory history(config.rollback);
+    history.save(game, 0);
+    std::vector<unsigned int> inputs(config.ticks);
+    std::vector<int> serials(config.ticks);
+
+    typedef std::chrono::steady_clock Clock;
+    double saveSeconds = 0, rollbackSeconds = 0;
+    long long saves = 0, rollbacks = 0;
+    size_t maxSnapshot = 0, deltaTotal = 0;
+
+    for (int tick = 0; tick < config.ticks; tick++) {
+        serials[tick] = player.serial;
+        player.step(game, tick);
+        inputs[tick] = player.input;
+
+        Clock::time_point t0 = Clock::now();
+        history.save(game, tick + 1);
+        saveSeconds += std::chrono::duration<double>(Clock::now() - t0).count();
+        saves++;
+        maxSnapshot = std::max(maxSnapshot, history.snapshotBytes());
+        deltaTotal += history.lastDeltaBytes();
+
+        if (tick + 1 >= config.rollback) {
+            Clock::time_point t1 = Clock::now();
+            int serial = player.serial;
+            bool ok = resimulate(game, history, tick + 1 - config.rollback, [&](uint64_t t) {
+                player.serial = serials[t];
+                player.apply(game, inputs[t]);
+            });
+            if (!ok || player.serial != serial) {
+                std::cerr << "ѹ : ƽ " << tick << std::endl;
+                break;
+            }
+            rollbackSeconds += std::chrono::duration<double>(Clock::now() - t1).count();
+            rollbacks++;
+        }
+    }
+
+    std::cout << "snapshot: " << maxSnapshot << " bytes max, delta " << (saves ? deltaTotal / saves : 0)
+        << " bytes avg, save " << (saves ? saveSeconds * 1e3 / saves : 0) << " ms/tick" << std::endl;
+    std::cout << "rollback " << config.rollback << " ticks: " << (rollbacks ? rollbackSeconds * 1e3 / rollbacks : 0)
+        << " ms (restore + resimulate)" << std::endl;
+    return game.stateHash();
+}
+
+// ù ࿡ ۵ ִ ũ ڶ, reset   Է  °  Ҵ  Ѵ.
+//  ° (reset ) Ҵ  ش.
+long long countAllocations(const RunConfig& config, const std::vector<ScriptEntry>& script,
+    const std::vector<PatternDef>& patterns, JobPool* jobs) {
+    Game game(config.seed, jobs);
+    game.setPatterns(patterns);
+    game.collisionMode = config.collisionMode;
+    game.enemyCount = config.enemies;
+    game.reset(config.seed);
+
+    long long total = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        long long before = allocationCount.load();
+        if (pass == 1) game.reset(config.seed);
+        long long resetAllocs = allocationCount.load() - before;
+
+        ScriptPlayer player(config, script);
+        long long worst = 0;
+        int worstTick = -1;
+        total = resetAllocs;
+        for (int tick = 0; tick < config.ticks; tick++) {
+            long long start = allocationCount.load();
+            player.step(game, tick);
+            long long allocs = allocationCount.load() - start;
+            total += allocs;
+            if (allocs > worst) {
+                worst = allocs;
+                worstTick = tick;
+            }
+        }
+
+        std::cout << (pass == 0 ? "warm-up run" : "after reset") << ": " << total << " allocations";
+        if (pass == 1) std::cout << " (reset " << resetAllocs << ")";
+        if (worstTick >= 0) std::cout << ", max " << worst << "/tick at tick " << worstTick;
+        std::cout << std::endl;
+    }
+    return total;
+}
+
+int main(int argc, char** argv) {
+    RunConfig config;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--ticks" && hasValue) config.ticks = std::atoi(argv[++i]);
+        else if (arg == "--dt" && hasValue) config.deltaTime = (float)std::atof(argv[++i]);
+        else if (arg == "--seed" && hasValue) config.seed = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--script" && hasValue) config.scriptPath = argv[++i];
+        else if (arg == "--runs" && hasValue) config.runs = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--patterns" && hasValue) config.patternPath = argv[++i];
+        else if (arg == "--jobs" && hasValue) config.jobs = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--stress" && hasValue) config.stress = std::min(MAX_BULLETS, std::max(0, std::atoi(argv[++i])));
+        else if (arg == "--count-allocs") config.countAllocs = true;
+        else if (arg == "--swept") config.collisionMode = COLLISION_SWEPT;
+        else if (arg == "--enemies" && hasValue) config.enemies = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--record" && hasValue) config.recordPath = argv[++i];
+        else if (arg == "--replay" && hasValue) config.replayPath = argv[++i];
+        else if (arg == "--rollback" && hasValue) config.rollback = std::max(0, std::atoi(argv[++i]));
+        else {
+            std::cerr << ": " << argv[0]
+                << " [--ticks N] [--dt ] [--seed N] [--script ] [--runs N] [--jobs N] [--stress N] [--patterns ]"
+                << " [--count-allocs] [--swept] [--enemies N]"
+                << " [--record ] [--replay ] [--rollback N]" << std::endl;
+            return 2;
+        }
+    }
+
+    std::vector<ScriptEntry> script;
+    if (!config.scriptPath.empty() && !loadScript(config.scriptPath, script)) {
+        std::cerr << "ũƮ   ϴ: " << config.scriptPath << std::endl;
+        return 1;
+    }
+
+    std::vector<PatternDef> patterns = defaultPatterns();
+    std::string error;
+    if (!config.patternPath.empty() && !loadPatterns(config.patternPath, patterns, error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    // ÷̴ ȭ   
+    Replay replay;
+    if (!config.replayPath.empty()) {
+        if (!loadReplay(config.replayPath, replay, error)) {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        config.seed = replay.seed;
+        config.deltaTime = replay.deltaTime;
+        config.enemies = replay.enemyCount;
+        config.collisionMode = (CollisionMode)replay.collisionMode;
+        config.ticks = (int)replay.tickCount;
+        if (replay.patternsHash != patternsHash(patterns)) {
+            std::cerr << ": ȭ  ź  ٸϴ (--patterns Ȯ)" << std::endl;
+        }
+    }
+    const Replay* replayInput = config.replayPath.empty() ? nullptr : &replay;
+    ReplayRecorder recorder;
+
+    //   ۾ Ǯ ϳ  
+    JobPool jobPool(config.jobs);
+
+    if (config.countAllocs) {
+        long long steady = countAllocations(config, script, patterns, config.jobs > 0 ? &jobPool : nullptr);
+        if (steady != 0) {
+            std::cerr << " ¿  Ҵ ֽϴ" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    // ѹ  ׳   ƾ Ѵ
+    if (config.rollback > 0) {
+        JobPool* pool = config.jobs > 0 ? &jobPool : nullptr;
+        uint64_t straight = runSimulation(config, script, patterns, pool, replayInput);
+        uint64_t rolled = runRollback(config, script, patterns, pool, replayInput);
+        char a[32], b[32];
+        std::snprintf(a, sizeof(a), "%016llx", (unsigned long long)straight);
+        std::snprintf(b, sizeof(b), "%016llx", (unsigned long long)rolled);
+        std::cout << "hash: " << a << ", with rollback: " << b << std::endl;
+        if (straight != rolled) {
+            std::cerr << "ѹ  ٸϴ" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    //  Է    ؽð  ƾ Ѵ
+    std::vector<uint64_t> hashes(config.runs);
+    int threadCount = (int)std::min<unsigned>(std::max(1u, std::thread::hardware_concurrency()), config.runs);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t] {
+            for (int run = t; run < config.runs; run += threadCount) {
+                hashes[run] = runSimulation(config, script, patterns, config.jobs > 0 ? &jobPool : nullptr,
+                    replayInput, run == 0 && !config.recordPath.empty() ? &recorder : nullptr);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double ticksPerSecond = (double)config.ticks * config.runs / seconds;
+
+    char hash[32];
+    std::snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)hashes[0]);
+    std::cout << "ticks: " << config.ticks << ", dt: " << config.deltaTime
+        << ", seed: " << config.seed << ", runs: " << config.runs
+        << ", jobs: " << config.jobs << ", stress: " << config.stress
+        << ", collision: " << (config.collisionMode == COLLISION_SWEPT ? "swept" : "discrete")
+        << ", enemies: " << config.enemies << std::endl;
+    std::cout << "hash: " << hash << std::endl;
+    std::cout << "ticks/s: " << (long long)ticksPerSecond
+        << " (ǽð " << (long long)(ticksPerSecond * config.deltaTime) << ")" << std::endl;
+
+    for (int run = 1; run < config.runs; run++) {
+        if (hashes[run] != hashes[0]) {
+            std::cerr << " :  " << run << " ؽð ٸϴ" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!config.recordPath.empty()) {
+        if (!saveReplay(config.recordPath, recorder.replay)) {
+            std::cerr << "÷̸   ϴ: " << config.recordPath << std::endl;
+            return 1;
+        }
+        std::cout << "recorded: " << config.recordPath << " (" << recorder.replay.runs.size() << " runs)" << std::endl;
+    }
+    if (replayInput && replay.finalHash != 0 && replay.finalHash != hashes[0]) {
+        std::snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)replay.finalHash);
+        std::cerr << " : ȭ  ؽô " << hash << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <type_traits>
+
+// ۾ ġ(work-stealing)  Ǯ
+// parallelFor   ûũ  ۾ں ť  ,  ۾ڴ ڱ ť ڿ
+//   ٸ ť տ  ´. ȣ 嵵    Ѵ.
+// ûũ ȣ    ϹǷ   ϰ  .
+class JobPool {
+public:
+    // threads: ۾   (ȣ  ).  ھ  - 1
+    explicit JobPool(int threads = -1) : stopping(false), pending(0) {
+        if (threads < 0) {
+            threads = (int)std::max(1u, std::thread::hardware_concurrency()) - 1;
+        }
+        for (int i = 0; i < threads; i++) {
+            queues.emplace_back(new WorkQueue());
+        }
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~JobPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    int workerCount() const { return (int)workers.size(); }
+
+    // [0, count)  chunkSize   fn(begin, end, chunkIndex)  ϰ,   ƿ´
+    template <typename F>
+    void parallelFor(int count, int chunkSize, F&& fn) {
+        typedef typename std::remove_reference<F>::type Fn;
+        run(count, chunkSize, [](void* ctx, int begin, int end, int chunk) {
+            (*(Fn*)ctx)(begin, end, chunk);
+        }, (void*)&fn);
+    }
+
+    static int chunkCount(int count, int chunkSize) {
+        return (count + chunkSize - 1) / chunkSize;
+    }
+
+private:
+    typedef void (*TaskFn)(void* ctx, int begin, int end, int chunk);
+
+    struct Task {
+        TaskFn fn;
+        void* ctx;
+        int begin, end, chunk;
+        std::atomic<int>* remaining;
+    };
+
+    //  ũ  ť (Ӹ Ҵ ʵ)
+    struct WorkQueue {
+        static const int CAPACITY = 1024;
+        std::mutex mutex;
+        Task tasks[CAPACITY];
+        int head = 0, size = 0;
+
+        bool push(const Task& task) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (size == CAPACITY) return false;
+            tasks[(head + size) % CAPACITY] = task;
+            size++;
+            return true;
+        }
+
+        //  ڿ 
+        bool popBack(Task& task) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (size == 0) return false;
+            size--;
+            task = tasks[(head + size) % CAPACITY];
+            return true;
+        }
+
+        // ٸ  տ ģ
+        bool stealFront(Task& task) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (size == 0) return false;
+            task = tasks[head];
+            head = (head + 1) % CAPACITY;
+            size--;
+            return true;
+        }
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping;
+    std::atomic<int> pending; // ť  ִ ۾ 
+
+    static void execute(const Task& task) {
+        task.fn(task.ctx, task.begin, task.end, task.chunk);
+        task.remaining->fetch_sub(1, std::memory_order_release);
+    }
+
+    bool tryTake(int self, Task& task) {
+        int n = (int)queues.size();
+        if (self >= 0 && queues[self]->popBack(task)) return true;
+        for (int k = 1; k <= n; k++) {
+            int victim = ((self < 0 ? 0 : self) + k) % n;
+            if (queues[victim]->stealFront(task)) return true;
+        }
+        return false;
+    }
+
+    void run(int count, int chunkSize, TaskFn fn, void* ctx) {
+        int chunks = chunkCount(count, chunkSize);
+        if (queues.empty() || chunks <= 1) {
+            for (int c = 0; c < chunks; c++) {
+                fn(ctx, c * chunkSize, std::min(count, (c + 1) * chunkSize), c);
+            }
+            return;
+        }
+
+        std::atomic<int> remaining(chunks);
+        for (int c = 0; c < chunks; c++) {
+            Task task = { fn, ctx, c * chunkSize, std::min(count, (c + 1) * chunkSize), c, &remaining };
+            if (queues[c % queues.size()]->push(task)) {
+                pending.fetch_add(1, std::memory_order_release);
+            }
+            else {
+                execute(task); // ť   ٷ 
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wake.notify_all();
+
+        // ȣ 嵵  ûũ ļ ó
+        Task task;
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (tryTake(-1, task)) {
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                execute(task);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void workerLoop(int self) {
+        Task task;
+        for (;;) {
+            if (tryTake(self, task)) {
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            if (stopping) return;
+            wake.wait_for(lock, std::chrono::milliseconds(2), [this] {
+                return stopping || pending.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping) return;
+        }
+    }
+};
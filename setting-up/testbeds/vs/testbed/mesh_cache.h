@@ -0,0 +1,133 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include <cmath>
+
+// ġ +    
+struct MeshVertex {
+    float x, y;
+    float r, g, b;
+};
+
+// ĳ ޽ ĳ
+//   /簢/ﰢ ׸  ״ ﰢ  켭 VBO ϳ ÷ ΰ,
+// ׸  ޽ø ̵   + glDrawArrays   Ѵ.    ִ.
+//
+//   int body = meshCache.begin();
+//   meshCache.color(1, 0, 0);
+//   meshCache.circle(0, 0, 0.1f);
+//   meshCache.end();
+//   ...
+//   meshCache.upload();
+//
+//   meshCache.bind();
+//   meshCache.draw(body, x, y);
+//   meshCache.unbind();
+class MeshCache {
+public:
+    MeshCache() : vbo(0), r(1), g(1), b(1) {}
+
+    //  ޽ø ϰ ȣ ش
+    int begin() {
+        MeshRange range = { (int)vertices.size(), 0 };
+        ranges.push_back(range);
+        return (int)ranges.size() - 1;
+    }
+
+    void end() {
+        MeshRange& range = ranges.back();
+        range.count = (int)vertices.size() - range.first;
+    }
+
+    void color(float red, float green, float blue) {
+        r = red;
+        g = green;
+        b = blue;
+    }
+
+    void triangle(float x0, float y0, float x1, float y1, float x2, float y2) {
+        vertex(x0, y0);
+        vertex(x1, y1);
+        vertex(x2, y2);
+    }
+
+    // GL_QUADS    
+    void quad(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3) {
+        triangle(x0, y0, x1, y1, x2, y2);
+        triangle(x0, y0, x2, y2, x3, y3);
+    }
+
+    // GL_TRIANGLE_FAN  : xy (x, y)  pointCount
+    void fan(float cx, float cy, const float* xy, int pointCount) {
+        for (int i = 0; i + 1 < pointCount; i++) {
+            triangle(cx, cy, xy[i * 2], xy[i * 2 + 1], xy[i * 2 + 2], xy[i * 2 + 3]);
+        }
+    }
+
+    void circle(float cx, float cy, float radius, int segments = 32) {
+        std::vector<float> rim;
+        for (int i = 0; i <= segments; i++) {
+            float angle = i * 2.0f * 3.14159265f / segments;
+            rim.push_back(cx + cos(angle) * radius);
+            rim.push_back(cy + sin(angle) * radius);
+        }
+        fan(cx, cy, rim.data(), segments + 1);
+    }
+
+    //   GPU ø CPU  纻 
+    void upload() {
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex), vertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        std::vector<MeshVertex>().swap(vertices);
+    }
+
+    void cleanup() {
+        if (vbo) glDeleteBuffers(1, &vbo);
+        vbo = 0;
+    }
+
+    //  ĳ͸ ׸   迭   
+    void bind() const {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+        glVertexPointer(2, GL_FLOAT, sizeof(MeshVertex), (void*)0);
+        glColorPointer(3, GL_FLOAT, sizeof(MeshVertex), (void*)(2 * sizeof(float)));
+    }
+
+    void draw(int mesh, float x, float y) const {
+        const MeshRange& range = ranges[mesh];
+        glPushMatrix();
+        glTranslatef(x, y, 0);
+        glDrawArrays(GL_TRIANGLES, range.first, range.count);
+        glPopMatrix();
+    }
+
+    void unbind() const {
+        glDisableClientState(GL_COLOR_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    GLuint buffer() const { return vbo; }
+    int firstVertex(int mesh) const { return ranges[mesh].first; }
+    int vertexCount(int mesh) const { return ranges[mesh].count; }
+
+private:
+    struct MeshRange {
+        int first, count;
+    };
+
+    GLuint vbo;
+    std::vector<MeshVertex> vertices;
+    std::vector<MeshRange> ranges;
+    float r, g, b;
+
+    void vertex(float x, float y) {
+        MeshVertex v = { x, y, r, g, b };
+        vertices.push_back(v);
+    }
+};
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "glm_config.h"
+#include <glm/glm.hpp>
+#include <glm/simd/common.h>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include "fast_trig.h"
+#include "rng.h"
+#include "bullet_kernel.h" // kernelMulAddSSE/AVX2
+
+// ƼŬ (ǰ Ҳ, )
+// ʵ帶 迭(SoA) ΰ  뷮  ִ´.  ƼŬ head  ,   
+//   .  ִ ƼŬ  [tail, head)      tail 
+//  ( ̶ ߰   ĭ ׸  ǳʶڴ).
+//    ƾ    SIMD Ŀη , Ҵ    ̴.
+// ̱⸸ ϴ ȿ  ؽÿ   ʴ´ (Ѹ    Ʈ ).
+//
+//   ParticleSystem particles(MAX_PARTICLES, PARTICLE_STYLES, 0.05f);
+//   particles.burst(x, y, 8, PARTICLE_HIT, rng);
+//   particles.update(SIM_DT);
+//   for (int k = 0; k < particles.size(); k++) { int i = particles.slot(k); ... }
+
+struct ParticleStyle {
+    float speedMin, speedMax; // ó ӷ
+    float lifeMin, lifeMax;   //  ()
+    float size;               // ó ũ ( Ҽ 0 پ)
+    float r0, g0, b0;         // ó 
+    float r1, g1, b1;         //   
+};
+
+// Ѹ /ӷ/    ̴  ũ ( )
+const int PARTICLE_RANDOM_BATCH = 64;
+
+// ƼŬ : ġ += ӵ * dt, ӵ *= damp,  -= dt
+inline void integrateParticlesScalar(float* px, float* py, float* vx, float* vy, float* life,
+    int count, float deltaTime, float damp) {
+    for (int i = 0; i < count; i++) {
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+        vx[i] *= damp;
+        vy[i] *= damp;
+        life[i] -= deltaTime;
+    }
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+inline void integrateParticlesSSE(float* px, float* py, float* vx, float* vy, float* life,
+    int count, float deltaTime, float damp) {
+    glm_vec4 const dt = _mm_set1_ps(deltaTime);
+    glm_vec4 const d = _mm_set1_ps(damp);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        glm_vec4 const x = _mm_loadu_ps(vx + i);
+        glm_vec4 const y = _mm_loadu_ps(vy + i);
+        _mm_storeu_ps(px + i, kernelMulAddSSE(x, dt, _mm_loadu_ps(px + i)));
+        _mm_storeu_ps(py + i, kernelMulAddSSE(y, dt, _mm_loadu_ps(py + i)));
+        _mm_storeu_ps(vx + i, _mm_mul_ps(x, d));
+        _mm_storeu_ps(vy + i, _mm_mul_ps(y, d));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt));
+    }
+    integrateParticlesScalar(px + i, py + i, vx + i, vy + i, life + i, count - i, deltaTime, damp);
+}
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+inline void integrateParticlesAVX2(float* px, float* py, float* vx, float* vy, float* life,
+    int count, float deltaTime, float damp) {
+    __m256 const dt = _mm256_set1_ps(deltaTime);
+    __m256 const d = _mm256_set1_ps(damp);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 const x = _mm256_loadu_ps(vx + i);
+        __m256 const y = _mm256_loadu_ps(vy + i);
+        _mm256_storeu_ps(px + i, kernelMulAddAVX2(x, dt, _mm256_loadu_ps(px + i)));
+        _mm256_storeu_ps(py + i, kernelMulAddAVX2(y, dt, _mm256_loadu_ps(py + i)));
+        _mm256_storeu_ps(vx + i, _mm256_mul_ps(x, d));
+        _mm256_storeu_ps(vy + i, _mm256_mul_ps(y, d));
+        _mm256_storeu_ps(life + i, _mm256_sub_ps(_mm256_loadu_ps(life + i), dt));
+    }
+    integrateParticlesSSE(px + i, py + i, vx + i, vy + i, life + i, count - i, deltaTime, damp);
+}
+#endif
+
+//     ִ   θ 
+inline void integrateParticles(float* px, float* py, float* vx, float* vy, float* life,
+    int count, float deltaTime, float damp) {
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    integrateParticlesAVX2(px, py, vx, vy, life, count, deltaTime, damp);
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    integrateParticlesSSE(px, py, vx, vy, life, count, deltaTime, damp);
+#else
+    integrateParticlesScalar(px, py, vx, vy, life, count, deltaTime, damp);
+#endif
+}
+
+class ParticleSystem {
+public:
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life;       //   (, 0 ϸ )
+    std::vector<float> fade;       // 1 / ó  (life * fade  1 -> 0)
+    std::vector<uint8_t> style;    // styles  ȣ
+    const ParticleStyle* styles;
+    float drag;                    // 1   ӵ 
+
+    ParticleSystem(int capacity, const ParticleStyle* styles, float drag)
+        : posX(capacity), posY(capacity), velX(capacity), velY(capacity),
+        life(capacity), fade(capacity), style(capacity), styles(styles), drag(drag),
+        cap(capacity), tail(0), count(0), damp(1.0f), dampDeltaTime(0) {}
+
+    int capacity() const { return cap; }
+
+    // [tail, head)   (߰  ĭ )
+    int size() const { return count; }
+
+    //  k ° ĭ 迭  °ΰ ( ͺ)
+    int slot(int k) const {
+        int i = tail + k;
+        return i < cap ? i : i - cap;
+    }
+
+    int aliveCount() const {
+        int alive = 0;
+        for (int k = 0; k < count; k++) alive += life[slot(k)] > 0;
+        return alive;
+    }
+
+    void clear() {
+        tail = 0;
+        count = 0;
+    }
+
+    // (x, y)  n   Ѹ. /ӷ/ rng   ̴´
+    void burst(float x, float y, int n, int styleIndex, RandomStream& rng) {
+        const ParticleStyle& s = styles[styleIndex];
+        float r[PARTICLE_RANDOM_BATCH * 3];
+        for (int start = 0; start < n; start += PARTICLE_RANDOM_BATCH) {
+            int batch = std::min(PARTICLE_RANDOM_BATCH, n - start);
+            rng.fillFloat(r, batch * 3);
+            for (int k = 0; k < batch; k++) {
+                if (count == cap) { //      
+                    tail = slot(1);
+                    count--;
+                }
+                int i = slot(count++);
+                float angle = (r[3 * k] * 2.0f - 1.0f) * glm::pi<float>();
+                float speed = s.speedMin + (s.speedMax - s.speedMin) * r[3 * k + 1];
+                float lifetime = s.lifeMin + (s.lifeMax - s.lifeMin) * r[3 * k + 2];
+                float sn, cs;
+                trigSinCos(angle, sn, cs);
+                posX[i] = x;
+                posY[i] = y;
+                velX[i] = cs * speed;
+                velY[i] = sn * speed;
+                life[i] = lifetime;
+                fade[i] = 1.0f / lifetime;
+                style[i] = (uint8_t)styleIndex;
+            }
+        }
+    }
+
+    void update(float deltaTime) {
+        if (count == 0) return;
+        if (deltaTime != dampDeltaTime) { // ƽ ̰ ״θ pow   
+            damp = std::pow(drag, deltaTime);
+            dampDeltaTime = deltaTime;
+        }
+
+        //  迭    
+        int first = std::min(count, cap - tail);
+        integrateParticles(&posX[tail], &posY[tail], &velX[tail], &velY[tail], &life[tail],
+            first, deltaTime, damp);
+        if (count > first) {
+            integrateParticles(&posX[0], &posY[0], &velX[0], &velY[0], &life[0],
+                count - first, deltaTime, damp);
+        }
+
+        while (count > 0 && life[tail] <= 0) {
+            tail = slot(1);
+            count--;
+        }
+    }
+
+private:
+    int cap;
+    int tail, count;
+    float damp;          // ƽ ϴ ӵ  (drag  deltaTime )
+    float dampDeltaTime;
+};
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "bullet_pool.h"
+#include "fast_trig.h"
+#include "game_clock.h"
+#include "rng.h"
+
+// ź  
+// ϸ ǥ(  (1, 0)   , ȸ, ӵ) ̸  ΰ,
+// ߻    Ҽ (ȸ) ؼ   Ǯ ä.
+// ﰢԼ     atan2/cos/sin   (fast_trig.h) θ.
+// spread/speedSpread  ָ Ѿ˸  ӵ  ´ (Game   Ʈ, rng.h).
+enum PatternType {
+    PATTERN_FAN,    // ÷̾  ä
+    PATTERN_RING,   //   
+    PATTERN_SPIRAL, // ߻縶   ư 
+    PATTERN_WAVE    // ÷̾   ¿ 鸮 ä
+};
+
+//  ߻翡  Ѿ   (߸ Ϸ   ʵ)
+const int PATTERN_MAX_COUNT = 4096;
+const int PATTERN_MAX_VOLLEYS_PER_TICK = 8;
+
+// Ѹ    ̴  ũ ( )
+const int PATTERN_RANDOM_BATCH = 128;
+
+struct PatternDef {
+    PatternType type;
+    int count;         //  ߻翡  Ѿ 
+    float step;        // ̿ Ѿ   (rad, fan/wave). ring/spiral 2/count
+    float speed;       // Ѿ ӵ
+    float centerSpeed; //  Ѿ ӵ (0̸ speed)
+    float interval;    // ߻  ()
+    float turn;        // ߻縶   ȸ (rad, ring/spiral)
+    float sway;        //   鸲  (rad, wave)
+    float swayRate;    // 鸲 ӵ (rad/s, wave)
+    float spread;      // Ѿ˸  +-spread ŭ ´ (rad, 0̸   )
+    float speedSpread; // Ѿ˸ ӵ +-speedSpread ŭ ´ (0.2 = +-20%)
+
+    // ̸  ǥ
+    std::vector<float> dirX, dirY, angle, speeds;
+
+    PatternDef() : type(PATTERN_FAN), count(1), step(0), speed(1.0f), centerSpeed(0),
+        interval(1.0f), turn(0), sway(0), swayRate(0), spread(0), speedSpread(0) {
+    }
+
+    bool aimed() const { return type == PATTERN_FAN || type == PATTERN_WAVE; }
+    bool random() const { return spread > 0 || speedSpread > 0; }
+
+    void build() {
+        dirX.resize(count);
+        dirY.resize(count);
+        angle.resize(count);
+        speeds.resize(count);
+
+        bool around = type == PATTERN_RING || type == PATTERN_SPIRAL;
+        float spacing = around ? 6.28318531f / count : step;
+        for (int i = 0; i < count; i++) {
+            // fan/wave   ʿ 
+            float offset = around ? i * spacing : (i - (count - 1) * 0.5f) * spacing;
+            angle[i] = offset;
+            dirX[i] = cos(offset);
+            dirY[i] = sin(offset);
+            bool center = !around && (count % 2 == 1) && i == count / 2;
+            speeds[i] = (center && centerSpeed > 0) ? centerSpeed : speed;
+        }
+    }
+};
+
+//  ϳ ߻ϴ Ÿ̸ӿ 
+struct PatternEmitter {
+    int pattern;
+    float timer;
+    Phase angle; // ring/spiral  
+    Phase phase; // wave 鸲 
+
+    PatternEmitter(int pattern = 0) : pattern(pattern), timer(0) {}
+};
+
+// Ѹ:  ä Ѿ n   ӵ  .
+// Ѿ˸ (, ӵ )  ,  Ѳ ̴´ (̴  Ѿ ).
+inline void scatterVolley(const PatternDef& def, BulletPool& pool, int first, int n, RandomStream& rng) {
+    float r[PATTERN_RANDOM_BATCH * 2];
+    for (int start = 0; start < n; start += PATTERN_RANDOM_BATCH) {
+        int batch = std::min(PATTERN_RANDOM_BATCH, n - start);
+        rng.fillRange(r, batch * 2, -1.0f, 1.0f);
+        for (int k = 0; k < batch; k++) {
+            int i = first + start + k;
+            float turn = r[2 * k] * def.spread;
+            float scale = 1.0f + r[2 * k + 1] * def.speedSpread;
+            float s, c;
+            trigSinCos(turn, s, c);
+            float vx = pool.velX[i], vy = pool.velY[i];
+            pool.velX[i] = (vx * c - vy * s) * scale;
+            pool.velY[i] = (vx * s + vy * c) * scale;
+            pool.rotation[i] += turn;
+        }
+    }
+}
+
+//    : (ox, oy) ߻, aimed  (tx, ty) ܴ
+inline void emitVolley(const PatternDef& def, PatternEmitter& emitter, BulletPool& pool, RandomStream& rng,
+    float ox, float oy, float tx, float ty) {
+    float base;
+    if (def.aimed()) {
+        base = trigAtan2(ty - oy, tx - ox);
+        if (def.type == PATTERN_WAVE) {
+            base += def.sway * trigSin(emitter.phase.signedRadians());
+            emitter.phase.advance(def.swayRate, def.interval);
+        }
+    }
+    else {
+        base = emitter.angle.signedRadians();
+        emitter.angle.advanceRadians(def.turn);
+    }
+    float bx, by;
+    trigSinCos(base, by, bx);
+
+    int n = def.count;
+    int first = pool.allocate(n);
+    for (int k = 0; k < n; k++) {
+        int i = first + k;
+        float dx = bx * def.dirX[k] - by * def.dirY[k];
+        float dy = bx * def.dirY[k] + by * def.dirX[k];
+        pool.posX[i] = ox;
+        pool.posY[i] = oy;
+        pool.prevX[i] = ox;
+        pool.prevY[i] = oy;
+        pool.velX[i] = dx * def.speeds[k];
+        pool.velY[i] = dy * def.speeds[k];
+        pool.rotation[i] = base + def.angle[k];
+        pool.active[i] = 1;
+    }
+    if (def.random()) scatterVolley(def, pool, first, n, rng);
+}
+
+// Ÿ̸Ӹ Ű   ŭ ߻Ѵ ( ƽ ª  ƽ  )
+inline void updateEmitter(const PatternDef& def, PatternEmitter& emitter, BulletPool& pool, RandomStream& rng,
+    float deltaTime, float ox, float oy, float tx, float ty) {
+    emitter.timer += deltaTime;
+    int volleys = 0;
+    while (emitter.timer >= def.interval) {
+        emitter.timer -= def.interval;
+        emitVolley(def, emitter, pool, rng, ox, oy, tx, ty);
+        if (++volleys == PATTERN_MAX_VOLLEYS_PER_TICK) {
+            emitter.timer = 0; // и ߻ 
+            break;
+        }
+    }
+}
+
+// ⺻ : ÷̾  0.4ʸ 3 ( 1.2, 翷 +-0.3rad 1.0)
+inline std::vector<PatternDef> defaultPatterns() {
+    PatternDef fan;
+    fan.type = PATTERN_FAN;
+    fan.count = 3;
+    fan.step = 0.3f;
+    fan.speed = 1.0f;
+    fan.centerSpeed = 1.2f;
+    fan.interval = 0.4f;
+    fan.build();
+    return std::vector<PatternDef>(1, fan);
+}
+
+// "Ű="   κ д´. ü  Ǽ Ѵ (atof ó Ʋ  0  ʴ´)
+inline bool parsePatternValue(const std::string& text, float& value) {
+    if (text.empty()) return false;
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    value = std::strtof(begin, &end);
+    return end == begin + text.size() && std::isfinite(value);
+}
+
+//   б
+//  ٿ  ϳ:  ̸ ڿ Ű=.  Ű ⺻, '#' ڴ ּ.
+//   fan    count=3  step=0.3 speed=1.0 center=1.2 interval=0.4
+//   spiral count=4  speed=0.7 interval=0.08 turn=0.2
+//   ring   count=24 speed=0.6 interval=1.5 spread=0.05 speedSpread=0.2
+// ϸ error  ȣ   false ش (out ǵ帮 )
+inline bool loadPatterns(const std::string& path, std::vector<PatternDef>& out, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = path + ":    ϴ";
+        return false;
+    }
+
+    std::vector<PatternDef> list;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream in(line);
+        std::string name;
+        if (!(in >> name)) continue;
+
+        std::ostringstream where;
+        where << path << ":" << lineNumber << ": ";
+
+        PatternDef def;
+        if (name == "fan") def.type = PATTERN_FAN;
+        else if (name == "ring") def.type = PATTERN_RING;
+        else if (name == "spiral") def.type = PATTERN_SPIRAL;
+        else if (name == "wave") def.type = PATTERN_WAVE;
+        else {
+            error = where.str() + "    '" + name + "'";
+            return false;
+        }
+
+        std::string token;
+        while (in >> token) {
+            size_t eq = token.find('=');
+            if (eq == std::string::npos) {
+                error = where.str() + "Ű=  ƴմϴ: " + token;
+                return false;
+            }
+            std::string key = token.substr(0, eq);
+            float value;
+            if (!parsePatternValue(token.substr(eq + 1), value)) {
+                error = where.str() + "'" + key + "'  ڰ ƴմϴ: " + token;
+                return false;
+            }
+            if (key == "count") {
+                // int  ٲٱ    (  float -> int ȯ ǵ ʴ´)
+                if (value < 1 || value > PATTERN_MAX_COUNT || value != std::floor(value)) {
+                    error = where.str() + "count 1 ̻ 4096   մϴ";
+                    return false;
+                }
+                def.count = (int)value;
+            }
+            else if (key == "step") def.step = value;
+            else if (key == "speed") def.speed = value;
+            else if (key == "center") def.centerSpeed = value;
+            else if (key == "interval") def.interval = value;
+            else if (key == "turn") def.turn = value;
+            else if (key == "sway") def.sway = value;
+            else if (key == "swayRate") def.swayRate = value;
+            else if (key == "spread") def.spread = value;
+            else if (key == "speedSpread") def.speedSpread = value;
+            else {
+                error = where.str() + "   Ű '" + key + "'";
+                return false;
+            }
+        }
+
+        if (!(def.interval > 0)) {
+            error = where.str() + "interval 0 Ŀ մϴ";
+            return false;
+        }
+        if (def.spread < 0 || def.speedSpread < 0 || def.speedSpread >= 1) {
+            error = where.str() + "spread 0 ̻, speedSpread 0 ̻ 1 ̸̾ մϴ";
+            return false;
+        }
+        def.build();
+        list.push_back(def);
+    }
+
+    if (list.empty()) {
+        error = path + ":  ϴ";
+        return false;
+    }
+    out.swap(list);
+    return true;
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+//  CPU Ϸ
+// PROFILE_SCOPE(PROFILE_UPDATE) ó  θ / ð 帶 ϳ  ۿ δ.
+//  ( )   ,  尡 Ӹ collect()    
+// ĭ (seqlock) ξ д   ̺Ʈ . ʵ嵵 relaxed  
+// б Ⱑ ĵ   ƴϴ.
+// Ӻ  հ(HUD, CSV) ֱ ̺Ʈ(Chrome trace) .
+//
+//   profiler().beginFrame();          //  ۸ ( )
+//   { PROFILE_SCOPE(PROFILE_RENDER); game.render(alpha); }
+//   profiler().writeCSV("profile.csv");
+//   profiler().writeTrace("trace.json"); // chrome://tracing Ǵ Perfetto  
+//
+//  setEnabled(true)    Ѵ (  PROFILE_SCOPE  ÷ ϳ д´).
+// PROFILER_ENABLED  0 ϸ PROFILE_SCOPE  ƹ ڵ嵵  ʴ´ (headless.cpp).
+//  ƼƼ/Ѿ˸   ȿ  ʰ ܰ ü Ѵ: ð    
+//  Ϻ Ŀ.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+//  . HUD PROFILE_UPDATE/RENDER/SWAP  ׾ ׸, 浹/ update  ȿ  ׸.
+//   ȿ  ִ ̴.
+enum ProfileScope {
+    PROFILE_UPDATE,     //  ƽ ùķ̼ (   ƽ)
+    PROFILE_INTEGRATE,  // Ѿ 
+    PROFILE_CULL,       // ȭ /Ȱ Ѿ 
+    PROFILE_COLLISION,  // 浹  (  +  )
+    PROFILE_JOB,        // ۾ Ǯ ûũ (۾ )
+    PROFILE_RENDER,     // ׸  
+    PROFILE_SWAP,       //  ü
+    PROFILE_SCOPE_COUNT
+};
+
+inline const char* profileScopeName(int scope) {
+    static const char* names[PROFILE_SCOPE_COUNT] = {
+        "update", "integrate", "cull", "collision", "job", "render", "swap"
+    };
+    return names[scope];
+}
+
+struct ProfileEvent {
+    uint32_t frame;
+    uint16_t scope;
+    uint16_t thread;
+    int64_t start;  // Ϸ ۺ ns
+    int64_t end;
+};
+
+//  ϳ  (ms)
+struct ProfileFrame {
+    uint32_t frame;
+    double frameMs;  //   ۺ   ۱
+    double scopeMs[PROFILE_SCOPE_COUNT];
+};
+
+class Profiler {
+public:
+    static const int RING_SIZE = 4096;      //  ( ̿ ̺  ̸   Ҵ´)
+    static const int HISTORY = 240;         // HUD/CSV    
+    static const int TRACE_CAPACITY = 1 << 18; // Chrome trace   ֱ ̺Ʈ 
+
+    Profiler() : origin(std::chrono::steady_clock::now()), currentFrame(0), frameStart(0),
+        enabled(false), frames(HISTORY), trace(TRACE_CAPACITY), traceNext(0), traceCount(0) {
+        for (ProfileFrame& f : frames) clearFrame(f, 0);
+    }
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    uint32_t frame() const { return currentFrame.load(std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool on) { enabled.store(on, std::memory_order_relaxed); }
+
+    //  ϳ    ִ´ ( )
+    void record(int scope, int64_t start, int64_t end) {
+        ThreadRing& ring = threadRing();
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        RingSlot& slot = ring.slots[head % RING_SIZE];
+        slot.sequence.store(writingSequence(head), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release); // ʵ庸 " " ǥð  ̰
+        slot.frame.store(frame(), std::memory_order_relaxed);
+        slot.scope.store((uint16_t)scope, std::memory_order_relaxed);
+        slot.start.store(start, std::memory_order_relaxed);
+        slot.end.store(end, std::memory_order_relaxed);
+        slot.sequence.store(writtenSequence(head), std::memory_order_release);
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    //  忡  ۸:   ̸ ݰ  
+    void beginFrame() {
+        int64_t t = now();
+        uint32_t f = frame();
+        ProfileFrame& last = frames[f % HISTORY];
+        if (last.frame == f) last.frameMs = (t - frameStart) / 1e6;
+        collect();
+
+        frameStart = t;
+        currentFrame.store(f + 1, std::memory_order_relaxed);
+        clearFrame(frames[(f + 1) % HISTORY], f + 1);
+    }
+
+    //     ̺Ʈ о   trace  ű
+    void collect() {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (auto& ring : rings) {
+            uint64_t head = ring->head.load(std::memory_order_acquire);
+            uint64_t tail = std::max(ring->tail, head > RING_SIZE ? head - RING_SIZE : 0);
+            for (uint64_t i = tail; i < head; i++) {
+                //       ĭ ٽ   
+                if (ring->head.load(std::memory_order_acquire) - i >= RING_SIZE) continue;
+                ProfileEvent e;
+                if (readSlot(*ring, i, e)) addEvent(e);
+            }
+            ring->tail = head;
+        }
+    }
+
+    //  ͺ ֱ HISTORY  ( Ӹ)
+    // HUD ó   θ   ӽ ޸𸮸 ѱ
+    std::pmr::vector<ProfileFrame> history(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const {
+        std::pmr::vector<ProfileFrame> list(resource);
+        list.reserve(HISTORY);
+        uint32_t f = frame();
+        for (uint32_t i = f >= HISTORY ? f - HISTORY + 1 : 0; i < f; i++) {
+            const ProfileFrame& pf = frames[i % HISTORY];
+            if (pf.frame == i) list.push_back(pf);
+        }
+        return list;
+    }
+
+    bool writeCSV(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file) return false;
+        file << "frame,frame_ms";
+        for (int s = 0; s < PROFILE_SCOPE_COUNT; s++) file << "," << profileScopeName(s) << "_ms";
+        file << "\n";
+        for (const ProfileFrame& pf : history()) {
+            file << pf.frame << "," << pf.frameMs;
+            for (int s = 0; s < PROFILE_SCOPE_COUNT; s++) file << "," << pf.scopeMs[s];
+            file << "\n";
+        }
+        return true;
+    }
+
+    // Chrome trace  (Ϸ ̺Ʈ "X", ð  us)
+    bool writeTrace(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file) return false;
+        file << "{\"traceEvents\":[\n";
+        int first = traceCount < TRACE_CAPACITY ? 0 : traceNext;
+        for (int n = 0; n < traceCount; n++) {
+            const ProfileEvent& e = trace[(first + n) % TRACE_CAPACITY];
+            file << (n ? ",\n" : "") << "{\"name\":\"" << profileScopeName(e.scope) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                << e.thread << ",\"ts\":" << e.start / 1000.0 << ",\"dur\":" << (e.end - e.start) / 1000.0
+                << ",\"args\":{\"frame\":" << e.frame << "}}";
+        }
+        file << "\n]}\n";
+        return true;
+    }
+
+private:
+    // ̺Ʈ  ĭ. sequence  head °  ̸ 2*head+1,   2*head+2
+    struct RingSlot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint32_t> frame{0};
+        std::atomic<uint16_t> scope{0};
+        std::atomic<int64_t> start{0};
+        std::atomic<int64_t> end{0};
+    };
+
+    //  ϳ   (    ϳ, д  collect ϳ)
+    struct ThreadRing {
+        std::atomic<uint64_t> head;
+        uint64_t tail; // collect  
+        uint16_t id;
+        RingSlot slots[RING_SIZE];
+
+        explicit ThreadRing(uint16_t id) : head(0), tail(0), id(id) {}
+    };
+
+    std::chrono::steady_clock::time_point origin;
+    std::atomic<uint32_t> currentFrame;
+    int64_t frameStart;
+    std::atomic<bool> enabled;
+
+    std::mutex ringsMutex; //   ٲ ( ù ) collect 
+    std::vector<std::unique_ptr<ThreadRing>> rings;
+
+    std::vector<ProfileFrame> frames; // frame % HISTORY
+    std::vector<ProfileEvent> trace;  //  
+    int traceNext, traceCount;
+
+    ThreadRing& threadRing() {
+        thread_local ThreadRing* ring = nullptr;
+        if (!ring) {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.emplace_back(new ThreadRing((uint16_t)rings.size()));
+            ring = rings.back().get();
+        }
+        return *ring;
+    }
+
+    static uint64_t writingSequence(uint64_t index) { return index * 2 + 1; }
+    static uint64_t writtenSequence(uint64_t index) { return index * 2 + 2; }
+
+    // index ° ̺Ʈ д´. յ  " " ״  
+    static bool readSlot(const ThreadRing& ring, uint64_t index, ProfileEvent& e) {
+        const RingSlot& slot = ring.slots[index % RING_SIZE];
+        uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before != writtenSequence(index)) return false;
+        e.frame = slot.frame.load(std::memory_order_relaxed);
+        e.scope = slot.scope.load(std::memory_order_relaxed);
+        e.thread = ring.id;
+        e.start = slot.start.load(std::memory_order_relaxed);
+        e.end = slot.end.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire); // ʵ带     ٽ 
+        return slot.sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    static void clearFrame(ProfileFrame& pf, uint32_t f) {
+        pf.frame = f;
+        pf.frameMs = 0;
+        for (int s = 0; s < PROFILE_SCOPE_COUNT; s++) pf.scopeMs[s] = 0;
+    }
+
+    void addEvent(const ProfileEvent& e) {
+        ProfileFrame& pf = frames[e.frame % HISTORY];
+        if (pf.frame == e.frame) pf.scopeMs[e.scope] += (e.end - e.start) / 1e6;
+
+        trace[traceNext] = e;
+        traceNext = (traceNext + 1) % TRACE_CAPACITY;
+        traceCount = std::min(traceCount + 1, TRACE_CAPACITY);
+    }
+};
+
+// α׷ ü ϳ
+inline Profiler& profiler() {
+    static Profiler instance;
+    return instance;
+}
+
+//     Ѵ
+class ScopedProfile {
+public:
+    explicit ScopedProfile(int scope) : scope(scope), start(profiler().isEnabled() ? profiler().now() : -1) {}
+
+    ~ScopedProfile() {
+        if (start >= 0) profiler().record(scope, start, profiler().now());
+    }
+
+private:
+    int scope;
+    int64_t start;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(scope) ScopedProfile PROFILE_CONCAT(profileScope, __LINE__)(scope)
+#else
+#define PROFILE_SCOPE(scope) ((void)0)
+#endif
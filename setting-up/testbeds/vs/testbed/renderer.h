@@ -0,0 +1,213 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include "sprite_batch.h"
+#include "mesh_cache.h"
+
+// ׸ 鿣
+// ǥ  ǥ [-1, 1] ״ . beginFrame ڿ ī޶ 鸲 ǰ,
+// beginUI ڿ  ʴ´. circle/bullet/star   ξٰ flush() 
+// ޽ø   ׸, drawMesh  ٷ ׸. rect  鿣忡  ٷ ׸ų
+//  ξٰ  flush/drawMesh/beginUI  ׸Ƿ,   flush()  θ.
+// Ѿ, ƼŬó  νϽ mapSprites/commitSprites  鿣尡  ޸𸮿  ä.
+//   LegacyRenderer  ȣȯ  (    + SpriteBatch + MeshCache)
+//   CoreRenderer    ھ  (core_renderer.h)
+
+// νϽ ׸ ޽ (׸ )
+enum SpriteMesh { SPRITE_STAR, SPRITE_BULLET, SPRITE_CIRCLE, SPRITE_SPARK, SPRITE_COUNT };
+
+//     ο ݰ   (beginFrame  0 ư)
+struct RenderStats {
+    int drawCalls;
+    int instances;       // νϽ ׸ Ʈ 
+    long long vertices;  // νϽ ׸ ޽    νϽ 
+};
+
+// 鿣尡   VBO (initVBOs  )
+struct RenderMeshes {
+    GLuint circleVBO;
+    int circleVertices;
+    GLuint bulletVBO;
+    int bulletVertices;
+    GLuint starVBO;
+    int starVertices;
+    GLuint sparkVBO;
+    int sparkVertices;
+    const MeshCache* characters;
+};
+
+class Renderer {
+public:
+    Renderer() : r(1), g(1), b(1) {
+        for (int i = 0; i < SPRITE_COUNT; i++) mappedFirst[i] = 0;
+        resetStats();
+    }
+    virtual ~Renderer() {}
+
+    virtual bool init(const RenderMeshes& meshes) = 0;
+    virtual void cleanup() = 0;
+    virtual const char* name() const = 0;
+
+    virtual void resize(int width, int height) = 0;
+    // ȭ   ȯ(ī޶ 鸲) Ǵ
+    virtual void beginFrame(float shakeX, float shakeY) = 0;
+    //  ׸⿡ ī޶ 鸲  ʴ´ (  Ʈ  flush  )
+    virtual void beginUI() = 0;
+    virtual void flush() = 0;
+
+    //  ĳ ޽ø (x, y)  Ű ׸
+    virtual void drawMesh(int mesh, float x, float y) = 0;
+    //   ä 簢 (UI)
+    virtual void rect(float left, float bottom, float right, float top) = 0;
+
+    // glColor3f ó  ׸  Ѵ
+    void color(float red, float green, float blue) {
+        r = red;
+        g = green;
+        b = blue;
+    }
+
+    void circle(float x, float y, float radius) { add(SPRITE_CIRCLE, x, y, radius, 0); }
+    void bullet(float x, float y, float radius, float rotation) { add(SPRITE_BULLET, x, y, radius, rotation); }
+    void star(float x, float y, float radius, float rotation) { add(SPRITE_STAR, x, y, radius, rotation); }
+
+    // νϽ count  ڸ ޴´.  ä    commitSprites  ѱ.
+    // ޽ø   ϳ   ְ,  ޽ÿ ռ  νϽ ڿ ׷.
+    // ⺻  ť ڿ ڸ δ (CoreRenderer  GPU ε ۸ ش)
+    virtual SpriteInstance* mapSprites(SpriteMesh mesh, int count) {
+        std::vector<SpriteInstance>& list = sprites[mesh];
+        mappedFirst[mesh] = list.size();
+        list.resize(mappedFirst[mesh] + count);
+        return list.data() + mappedFirst[mesh];
+    }
+
+    virtual void commitSprites(SpriteMesh mesh, int count) {
+        sprites[mesh].resize(mappedFirst[mesh] + count);
+    }
+
+    //  beginFrame  
+    const RenderStats& frameStats() const { return stats; }
+
+protected:
+    std::vector<SpriteInstance> sprites[SPRITE_COUNT];
+    size_t mappedFirst[SPRITE_COUNT];
+    float r, g, b;
+    RenderStats stats;
+
+    void resetStats() {
+        stats.drawCalls = 0;
+        stats.instances = 0;
+        stats.vertices = 0;
+    }
+
+    void countDraw(int calls, long long vertices, int instances = 0) {
+        stats.drawCalls += calls;
+        stats.vertices += vertices;
+        stats.instances += instances;
+    }
+
+    void add(SpriteMesh mesh, float x, float y, float scale, float rotation) {
+        SpriteInstance inst = { x, y, scale, rotation, r, g, b };
+        sprites[mesh].push_back(inst);
+    }
+};
+
+// ȣȯ  鿣:  SpriteBatch/MeshCache θ ״ 
+class LegacyRenderer : public Renderer {
+public:
+    LegacyRenderer() : characters(nullptr), meshBound(false) {
+        for (int i = 0; i < SPRITE_COUNT; i++) spriteVertices[i] = 0;
+    }
+
+    bool init(const RenderMeshes& meshes) override {
+        spriteBatch.init(meshes.circleVBO, meshes.circleVertices, meshes.bulletVBO, meshes.bulletVertices,
+            meshes.starVBO, meshes.starVertices, meshes.sparkVBO, meshes.sparkVertices);
+        characters = meshes.characters;
+        spriteVertices[SPRITE_STAR] = meshes.starVertices;
+        spriteVertices[SPRITE_BULLET] = meshes.bulletVertices;
+        spriteVertices[SPRITE_CIRCLE] = meshes.circleVertices;
+        spriteVertices[SPRITE_SPARK] = meshes.sparkVertices;
+        return true;
+    }
+
+    void cleanup() override {
+        spriteBatch.cleanup();
+    }
+
+    const char* name() const override { return "legacy"; }
+
+    void resize(int width, int height) override {
+        glViewport(0, 0, width, height);
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glOrtho(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+    }
+
+    void beginFrame(float shakeX, float shakeY) override {
+        spriteBatch.nextFrame();
+        resetStats();
+        glClear(GL_COLOR_BUFFER_BIT);
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+        glTranslatef(shakeX, shakeY, 0);
+    }
+
+    void beginUI() override {
+        unbindMeshes();
+        glLoadIdentity();
+    }
+
+    void flush() override {
+        unbindMeshes();
+        for (int m = 0; m < SPRITE_COUNT; m++) {
+            int count = (int)sprites[m].size();
+            if (count > 0) {
+                // νϽ  νϽ ο  ϳ
+                countDraw(spriteBatch.instanced() ? 1 : count, (long long)spriteVertices[m] * count, count);
+            }
+            spriteBatch.draw((SpriteBatch::Mesh)m, sprites[m]);
+            sprites[m].clear();
+        }
+    }
+
+    // ĳͰ ̾ ׷  迭  ó   Ѵ
+    void drawMesh(int mesh, float x, float y) override {
+        if (!meshBound) {
+            characters->bind();
+            meshBound = true;
+        }
+        characters->draw(mesh, x, y);
+        countDraw(1, characters->vertexCount(mesh));
+    }
+
+    void rect(float left, float bottom, float right, float top) override {
+        unbindMeshes();
+        glColor3f(r, g, b);
+        glBegin(GL_QUADS);
+        glVertex2f(left, top);
+        glVertex2f(right, top);
+        glVertex2f(right, bottom);
+        glVertex2f(left, bottom);
+        glEnd();
+        countDraw(1, 4);
+    }
+
+private:
+    SpriteBatch spriteBatch;
+    const MeshCache* characters;
+    bool meshBound;
+    int spriteVertices[SPRITE_COUNT];
+
+    void unbindMeshes() {
+        if (meshBound) {
+            characters->unbind();
+            meshBound = false;
+        }
+    }
+};
+
+static_assert((int)SPRITE_STAR == (int)SpriteBatch::MESH_STAR && (int)SPRITE_BULLET == (int)SpriteBatch::MESH_BULLET
+    && (int)SPRITE_CIRCLE == (int)SpriteBatch::MESH_CIRCLE && (int)SPRITE_SPARK == (int)SpriteBatch::MESH_SPARK, "SpriteMesh  SpriteBatch::Mesh  ƾ Ѵ");
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include "game.h"
+
+// ÷ (ƽ Է Ʈ ״ ٽ    ȴ)
+// Է κ  ƽ  ǹǷ (Է, ̾ ƽ )  ٿ Ѵ.
+//  ð¥ ǵ   KB ̴.
+//
+//   (Ʋ )
+//   "RPLY" u16 
+//   u32 õ, f32 ƽ (), u16  , u8 浹 , u64  ؽ
+//   u32 ƽ , u64   ؽ (0 ̸ )
+//   varint  ,  u8 Է + varint ƽ 
+//
+//   recorder.begin(game, SIM_DT);
+//   recorder.record(input);        //  ƽ handleInput 
+//   recorder.finish(game);
+//   saveReplay("session.rpl", recorder.replay);
+
+// Է Ʈ ܿ ÷̿ ִ Ʈ:  ƽ  game.reset(seed)  θ (R Ű )
+const unsigned int REPLAY_RESET = 1 << 7;
+
+const uint16_t REPLAY_VERSION = 1;
+
+struct ReplayRun {
+    uint8_t input;
+    uint32_t ticks;
+};
+
+struct Replay {
+    uint32_t seed;
+    float deltaTime;
+    uint16_t enemyCount;
+    uint8_t collisionMode;
+    uint64_t patternsHash;
+    uint32_t tickCount;
+    uint64_t finalHash;
+    std::vector<ReplayRun> runs;
+
+    Replay() : seed(0), deltaTime(SIM_DT), enemyCount(1), collisionMode(COLLISION_DISCRETE),
+        patternsHash(0), tickCount(0), finalHash(0) {}
+};
+
+//   Ȯϴ ؽ (ǥ   ٽ Ƿ  ʴ´)
+inline uint64_t patternsHash(const std::vector<PatternDef>& patterns) {
+    StateHasher h;
+    for (const PatternDef& p : patterns) {
+        h.add(p.type);
+        h.add(p.count);
+        h.add(p.step);
+        h.add(p.speed);
+        h.add(p.centerSpeed);
+        h.add(p.interval);
+        h.add(p.turn);
+        h.add(p.sway);
+        h.add(p.swayRate);
+        if (p.random()) { // ѸⰡ    ÷̿  ؽ
+            h.add(p.spread);
+            h.add(p.speedSpread);
+        }
+    }
+    return h.value;
+}
+
+class ReplayRecorder {
+public:
+    Replay replay;
+
+    ReplayRecorder() : recording(false), pendingReset(false) {}
+
+    //     ȭ Ѵ (game   ų reset  ¿ Ѵ)
+    void begin(const Game& game, float deltaTime) {
+        replay = Replay();
+        replay.seed = game.seed;
+        replay.deltaTime = deltaTime;
+        replay.enemyCount = (uint16_t)game.enemyCount;
+        replay.collisionMode = (uint8_t)game.collisionMode;
+        replay.patternsHash = patternsHash(game.patterns);
+        replay.runs.reserve(1024);
+        recording = true;
+        pendingReset = false;
+    }
+
+    bool isRecording() const { return recording; }
+
+    //  ƽ  game.reset(seed)  ߴٰ ´
+    void markReset() { pendingReset = true; }
+
+    void record(unsigned int input) {
+        if (!recording) return;
+        uint8_t bits = (uint8_t)(input & 0xff);
+        if (pendingReset) {
+            bits |= REPLAY_RESET;
+            pendingReset = false;
+        }
+        if (!replay.runs.empty() && replay.runs.back().input == bits) {
+            replay.runs.back().ticks++;
+        }
+        else {
+            ReplayRun run = { bits, 1 };
+            replay.runs.push_back(run);
+        }
+        replay.tickCount++;
+    }
+
+    //       ؽø 
+    void finish(const Game& game) {
+        replay.finalHash = game.stateHash();
+        recording = false;
+    }
+
+private:
+    bool recording;
+    bool pendingReset;
+};
+
+//  ƽ Է 
+class ReplayCursor {
+public:
+    explicit ReplayCursor(const Replay& replay) : replay(replay), run(0), used(0) {}
+
+    bool done() const { return run >= replay.runs.size(); }
+
+    unsigned int next() {
+        if (done()) return 0;
+        unsigned int input = replay.runs[run].input;
+        if (++used >= replay.runs[run].ticks) {
+            run++;
+            used = 0;
+        }
+        return input;
+    }
+
+private:
+    const Replay& replay;
+    size_t run;
+    uint32_t used;
+};
+
+namespace replay_io {
+
+inline void putBytes(std::ostream& out, uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) out.put((char)((v >> (8 * i)) & 0xff));
+}
+
+inline bool getBytes(std::istream& in, uint64_t& v, int bytes) {
+    v = 0;
+    for (int i = 0; i < bytes; i++) {
+        int c = in.get();
+        if (c == EOF) return false;
+        v |= (uint64_t)(unsigned char)c << (8 * i);
+    }
+    return true;
+}
+
+inline void putVarint(std::ostream& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.put((char)((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.put((char)v);
+}
+
+inline bool getVarint(std::istream& in, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int c = in.get();
+        if (c == EOF) return false;
+        v |= (uint64_t)(c & 0x7f) << shift;
+        if (!(c & 0x80)) return true;
+    }
+    return false;
+}
+
+inline uint32_t floatBits(float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+inline float bitsFloat(uint32_t bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+} // namespace replay_io
+
+inline bool saveReplay(const std::string& path, const Replay& replay) {
+    using namespace replay_io;
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out.write("RPLY", 4);
+    putBytes(out, REPLAY_VERSION, 2);
+    putBytes(out, replay.seed, 4);
+    putBytes(out, floatBits(replay.deltaTime), 4);
+    putBytes(out, replay.enemyCount, 2);
+    putBytes(out, replay.collisionMode, 1);
+    putBytes(out, replay.patternsHash, 8);
+    putBytes(out, replay.tickCount, 4);
+    putBytes(out, replay.finalHash, 8);
+    putVarint(out, replay.runs.size());
+    for (const ReplayRun& run : replay.runs) {
+        putBytes(out, run.input, 1);
+        putVarint(out, run.ticks);
+    }
+    return (bool)out;
+}
+
+inline bool loadReplay(const std::string& path, Replay& replay, std::string& error) {
+    using namespace replay_io;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "÷̸   ϴ: " + path;
+        return false;
+    }
+
+    char magic[4];
+    uint64_t version, seed, dt, enemies, mode, patterns, ticks, hash, count;
+    if (!in.read(magic, 4) || std::string(magic, 4) != "RPLY" || !getBytes(in, version, 2)) {
+        error = "÷  ƴմϴ: " + path;
+        return false;
+    }
+    if (version != REPLAY_VERSION) {
+        error = " ʴ ÷ : " + std::to_string(version);
+        return false;
+    }
+    if (!getBytes(in, seed, 4) || !getBytes(in, dt, 4) || !getBytes(in, enemies, 2) || !getBytes(in, mode, 1)
+        || !getBytes(in, patterns, 8) || !getBytes(in, ticks, 4) || !getBytes(in, hash, 8)
+        || !getVarint(in, count)) {
+        error = "÷ Ӹ ߷Ƚϴ: " + path;
+        return false;
+    }
+
+    Replay loaded;
+    loaded.seed = (uint32_t)seed;
+    loaded.deltaTime = bitsFloat((uint32_t)dt);
+    loaded.enemyCount = (uint16_t)enemies;
+    loaded.collisionMode = (uint8_t)mode;
+    loaded.patternsHash = patterns;
+    loaded.tickCount = (uint32_t)ticks;
+    loaded.finalHash = hash;
+
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t input, length;
+        if (!getBytes(in, input, 1) || !getVarint(in, length) || length == 0) {
+            error = "÷ Է ߷Ƚϴ: " + path;
+            return false;
+        }
+        ReplayRun run = { (uint8_t)input, (uint32_t)length };
+        loaded.runs.push_back(run);
+        total += length;
+    }
+    if (total != loaded.tickCount) {
+        error = "÷ ƽ   ʽϴ: " + path;
+        return false;
+    }
+
+    replay = loaded;
+    return true;
+}
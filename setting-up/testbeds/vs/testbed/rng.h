@@ -0,0 +1,226 @@
+#pragma once
+
+//   (ī )
+//  (Ű, ī)  Լ̴: n °  = mix(mix(ī  32Ʈ ^ Ű) +  Ű).
+// ° ī ϳ̶ /÷̿ ״ , ӵ ī͸ θ 
+// SIMD      ̾Ƶ ϳ  Ͱ   ´.
+// mix  32Ʈ  /Ʈ  ܻ Լ(lowbias32)̹Ƿ ÷ Ϸ
+//    ´. std::rand, std::mt19937 +  Ŭ   ޶  ʴ´.
+//
+// ý۸ Ʈ  θ (,  AI, ƼŬ ...) ʿ ̴ Ƚ ٲ
+// ٸ   鸮 ʴ´.
+//
+//   RandomStream rng = randomStream(seed, RANDOM_PATTERNS);
+//   float a = rng.range(-0.1f, 0.1f);
+//   rng.fillRange(buffer, 256, 0.0f, 1.0f);   //    
+//   glm::vec2 p = diskRand(rng, 0.5f);
+#include "glm_config.h"
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <glm/glm.hpp>
+#include "fast_trig.h"
+
+inline uint32_t randomMix32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// õ Ʈ ȣ Ű ĥ  (splitmix64)
+inline uint64_t randomMix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// [0, 1):  24Ʈ float  ״ ִ´ (  Ȯ ǥȴ)
+inline float randomUnit(uint32_t bits) {
+    return (float)(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// ī  32Ʈ lo, lo+1, ...  n  (  , ġ ʾƾ Ѵ)
+inline void randomFillScalar(uint32_t* out, int n, uint32_t key, uint32_t blockKey, uint32_t lo) {
+    for (int i = 0; i < n; i++) {
+        out[i] = randomMix32(randomMix32((lo + (uint32_t)i) ^ key) + blockKey);
+    }
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+// SSE2  32Ʈ ()  ¦/Ȧ  64Ʈ     Ѵ
+inline __m128i randomMulSSE(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+        _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+inline __m128i randomMixSSE(__m128i x) {
+    __m128i const m1 = _mm_set1_epi32((int)0x7feb352du);
+    __m128i const m2 = _mm_set1_epi32((int)0x846ca68bu);
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+    x = randomMulSSE(x, m1);
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 15));
+    x = randomMulSSE(x, m2);
+    return _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+}
+
+// 4
+inline void randomFillSSE(uint32_t* out, int n, uint32_t key, uint32_t blockKey, uint32_t lo) {
+    __m128i const k = _mm_set1_epi32((int)key);
+    __m128i const b = _mm_set1_epi32((int)blockKey);
+    __m128i const step = _mm_set1_epi32(4);
+    __m128i counter = _mm_add_epi32(_mm_set1_epi32((int)lo), _mm_setr_epi32(0, 1, 2, 3));
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = randomMixSSE(_mm_add_epi32(randomMixSSE(_mm_xor_si128(counter, k)), b));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+        counter = _mm_add_epi32(counter, step);
+    }
+    randomFillScalar(out + i, n - i, key, blockKey, lo + (uint32_t)i);
+}
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+inline __m256i randomMixAVX2(__m256i x) {
+    __m256i const m1 = _mm256_set1_epi32((int)0x7feb352du);
+    __m256i const m2 = _mm256_set1_epi32((int)0x846ca68bu);
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    x = _mm256_mullo_epi32(x, m1);
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15));
+    x = _mm256_mullo_epi32(x, m2);
+    return _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+}
+
+// 8
+inline void randomFillAVX2(uint32_t* out, int n, uint32_t key, uint32_t blockKey, uint32_t lo) {
+    __m256i const k = _mm256_set1_epi32((int)key);
+    __m256i const b = _mm256_set1_epi32((int)blockKey);
+    __m256i const step = _mm256_set1_epi32(8);
+    __m256i counter = _mm256_add_epi32(_mm256_set1_epi32((int)lo), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = randomMixAVX2(_mm256_add_epi32(randomMixAVX2(_mm256_xor_si256(counter, k)), b));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+        counter = _mm256_add_epi32(counter, step);
+    }
+    randomFillSSE(out + i, n - i, key, blockKey, lo + (uint32_t)i);
+}
+#endif
+
+//     ִ   θ  ( ε  )
+inline void randomFill(uint32_t* out, int n, uint32_t key, uint32_t blockKey, uint32_t lo) {
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    randomFillAVX2(out, n, key, blockKey, lo);
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    randomFillSSE(out, n, key, blockKey, lo);
+#else
+    randomFillScalar(out, n, key, blockKey, lo);
+#endif
+}
+
+//  Ʈ ϳ. ϸ   ̾ ̴  ȴ (POD, 16Ʈ).
+struct RandomStream {
+    uint32_t key;      // ī  32Ʈ  Ű
+    uint32_t blockKey; // ī  32Ʈ ٲ Ű 
+    uint64_t counter;  // ݱ  
+
+    uint32_t nextU32() {
+        uint32_t lo = (uint32_t)counter;
+        uint32_t value = randomMix32(randomMix32(lo ^ key) + currentBlockKey());
+        counter++;
+        return value;
+    }
+
+    // [0, 1)
+    float nextFloat() { return randomUnit(nextU32()); }
+
+    // [min, max)
+    float range(float min, float max) { return min + (max - min) * nextFloat(); }
+
+    // [0, n)  (n > 0).    Ʈ  ( 꺸 ġħ ۴)
+    uint32_t below(uint32_t n) { return (uint32_t)(((uint64_t)nextU32() * n) >> 32); }
+
+    // nextU32  n  θ Ͱ     ( 迡  ̴´)
+    void fillU32(uint32_t* out, int n) {
+        while (n > 0) {
+            uint32_t lo = (uint32_t)counter;
+            uint64_t room = 0x100000000ull - lo;
+            int chunk = (int)std::min<uint64_t>((uint64_t)n, room);
+            randomFill(out, chunk, key, currentBlockKey(), lo);
+            counter += (uint64_t)chunk;
+            out += chunk;
+            n -= chunk;
+        }
+    }
+
+    // [0, 1)  n . out  Ʈ ۷   ڸ ٲ۴ ( ϳ ڵ ȭȴ)
+    void fillFloat(float* out, int n) {
+        static_assert(sizeof(float) == sizeof(uint32_t), "float  32Ʈ Ѵ");
+        uint32_t* bits = reinterpret_cast<uint32_t*>(out);
+        fillU32(bits, n);
+        for (int i = 0; i < n; i++) out[i] = randomUnit(bits[i]);
+    }
+
+    // [min, max)  n 
+    void fillRange(float* out, int n, float min, float max) {
+        fillFloat(out, n);
+        float scale = max - min;
+        for (int i = 0; i < n; i++) out[i] = min + scale * out[i];
+    }
+
+private:
+    uint32_t currentBlockKey() const {
+        return randomMix32((uint32_t)(counter >> 32) ^ blockKey);
+    }
+};
+
+// seed  stream ° Ʈ (ȣ ٸ   ϴ)
+inline RandomStream randomStream(uint64_t seed, uint32_t stream) {
+    uint64_t k = randomMix64(seed ^ randomMix64(stream + 1ull));
+    RandomStream rng;
+    rng.key = (uint32_t)k;
+    rng.blockKey = (uint32_t)(k >> 32);
+    rng.counter = 0;
+    return rng;
+}
+
+// glm/gtc/random.hpp   ̸  (std::rand  Ʈ ̴´)
+inline float linearRand(RandomStream& rng, float min, float max) {
+    return rng.range(min, max);
+}
+
+template <glm::length_t L, glm::qualifier Q>
+glm::vec<L, float, Q> linearRand(RandomStream& rng, const glm::vec<L, float, Q>& min, const glm::vec<L, float, Q>& max) {
+    glm::vec<L, float, Q> v;
+    for (glm::length_t i = 0; i < L; i++) v[i] = rng.range(min[i], max[i]);
+    return v;
+}
+
+//  radius    
+inline glm::vec2 circularRand(RandomStream& rng, float radius) {
+    float s, c;
+    trigSinCos(rng.range(-glm::pi<float>(), glm::pi<float>()), s, c);
+    return glm::vec2(c, s) * radius;
+}
+
+//  radius     (̿ ). glm ó  ǥ  ̴ Ƚ
+// ߳ϹǷ ׻   ̴´. sqrt  IEEE  Ȯ ݿøǹǷ ̴.
+inline glm::vec2 diskRand(RandomStream& rng, float radius) {
+    float r = std::sqrt(rng.nextFloat()) * radius;
+    return circularRand(rng, r);
+}
+
+// Ժ ٻ (յ  12  - 6:  0, л Ȯ 1, +-6 ǥ ߸).
+// glm  ǥ  log  Ἥ ǥ ̺귯  Ʈ ޶  ִ.
+inline float gaussRand(RandomStream& rng, float mean, float deviation) {
+    float u[12];
+    rng.fillFloat(u, 12);
+    float sum = 0;
+    for (int i = 0; i < 12; i++) sum += u[i];
+    return mean + (sum - 6.0f) * deviation;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "game.h"
+
+// Է ũƮ (headless, bench_render  --script)
+//  ٿ "ƽ Է" ̸, Է   ƽ ȴ. '#'  ϴ  ּ.
+// Է : U() D(Ʒ) L() R() F(߻), ƹ Էµ  '-'
+//   0    -
+//   60   LF
+//   180  RF
+
+struct ScriptEntry {
+    int tick;
+    unsigned int input;
+};
+
+inline unsigned int parseInput(const std::string& text) {
+    unsigned int input = 0;
+    for (char c : text) {
+        switch (c) {
+        case 'U': case 'u': input |= INPUT_UP; break;
+        case 'D': case 'd': input |= INPUT_DOWN; break;
+        case 'L': case 'l': input |= INPUT_LEFT; break;
+        case 'R': case 'r': input |= INPUT_RIGHT; break;
+        case 'F': case 'f': input |= INPUT_FIRE; break;
+        default: break;
+        }
+    }
+    return input;
+}
+
+// ƽ   ش ( ƽ̸ Ͽ  )
+inline bool loadScript(const std::string& path, std::vector<ScriptEntry>& script) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream in(line);
+        ScriptEntry entry;
+        std::string keys;
+        if (!(in >> entry.tick)) continue;
+        in >> keys;
+        entry.input = parseInput(keys);
+        script.push_back(entry);
+    }
+    std::stable_sort(script.begin(), script.end(),
+        [](const ScriptEntry& a, const ScriptEntry& b) { return a.tick < b.tick; });
+    return true;
+}
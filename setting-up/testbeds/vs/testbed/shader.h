@@ -0,0 +1,57 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <iostream>
+
+// ̴ /ũ  (SpriteBatch  CoreRenderer   )
+
+inline GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint ok = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << "̴  : " << log << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// attribs  i° ̸ Ӽ ġ i ´ (GLSL 1.20ó layout   )
+// ϸ 0 ش
+inline GLuint linkProgram(const char* vertexSource, const char* fragmentSource,
+    const char* const* attribs = nullptr, int attribCount = 0) {
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    if (!vs || !fs) {
+        if (vs) glDeleteShader(vs);
+        if (fs) glDeleteShader(fs);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    for (int i = 0; i < attribCount; i++) {
+        glBindAttribLocation(program, i, attribs[i]);
+    }
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint ok = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[512];
+        glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+        std::cerr << "̴ ũ : " << log << std::endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
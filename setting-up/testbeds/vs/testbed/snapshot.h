@@ -0,0 +1,333 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+#include "game.h"
+
+//    ѹ
+//  ùķ̼ ¸ memcpy  ̾  Ʈ 迭̴ (Ʈ Ѿ 迭  POD).
+// , 浹 , ۾ Ǯ    Ƿ   Game  ǵ  ִ.
+//
+//   std::vector<uint8_t> snap;
+//   captureSnapshot(game, snap);
+//   ...
+//   restoreSnapshot(game, snap);   //  ,  ǰ
+//
+//   κ  Ƿ (ӵ, ȸ, Ʈ)   4Ʈ 
+//   ̸, ٸ  XOR  Ʈ ´ (encodeDelta/decodeDelta).
+//
+// RollbackHistory   ƽ  ޾ ֱ N ƽ ǵ  ְ Ѵ.  ֱ ¸ °
+// ΰ, ׺  ƽ " ƽ  ƽ " ̷ Ѵ. ѹ   ƽ̹Ƿ
+// ֱ ʺ ̸   Ǯ ȴ.
+//
+//   history.save(game, tick);                       //  ƽ update 
+//   resimulate(game, history, lateTick, [&](uint64_t t) { ... handleInput, update ... });
+
+//   (Game::serialize  Archive  ѱ)
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::vector<uint8_t>& out) : out(out) { out.clear(); }
+
+    template <typename T>
+    void value(const T& v) {
+        array(&v, 1);
+    }
+
+    // n   slots  ڸ 0  ä
+    template <typename T>
+    void array(const T* data, size_t n, size_t slots = 0) {
+        static_assert(std::is_trivially_copyable<T>::value, " POD    ִ");
+        size_t at = out.size();
+        size_t bytes = n * sizeof(T);
+        size_t total = std::max(n, slots) * sizeof(T);
+        out.resize(at + total);
+        if (bytes) std::memcpy(out.data() + at, data, bytes);
+        if (total > bytes) std::memset(out.data() + at + bytes, 0, total - bytes);
+    }
+
+    template <typename T>
+    void vector(const std::vector<T>& v) {
+        value((uint32_t)v.size());
+        array(v.data(), v.size());
+    }
+
+private:
+    std::vector<uint8_t>& out;
+};
+
+//  б. ڶ ͸  ok  false  ǰ  ڷδ ƹ͵  ʴ´.
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, size_t size) : data(data), size(size), at(0), ok(true) {}
+
+    template <typename T>
+    void value(T& v) {
+        array(&v, 1);
+    }
+
+    // n  а slots  ڸ ǳʶڴ
+    template <typename T>
+    void array(T* dest, size_t n, size_t slots = 0) {
+        static_assert(std::is_trivially_copyable<T>::value, " POD    ִ");
+        size_t bytes = n * sizeof(T);
+        size_t total = std::max(n, slots) * sizeof(T);
+        if (!ok || size - at < total) {
+            ok = false;
+            return;
+        }
+        if (bytes) std::memcpy(dest, data + at, bytes);
+        at += total;
+    }
+
+    template <typename T>
+    void vector(std::vector<T>& v) {
+        uint32_t n = 0;
+        value(n);
+        if (!ok || (size - at) / sizeof(T) < n) {
+            ok = false;
+            return;
+        }
+        v.resize(n);
+        array(v.data(), n);
+    }
+
+    //   о°
+    bool finished() const { return ok && at == size; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t at;
+    bool ok;
+};
+
+inline void captureSnapshot(const Game& game, std::vector<uint8_t>& out) {
+    SnapshotWriter writer(out);
+    const_cast<Game&>(game).serialize(writer); //   б⸸ Ѵ
+}
+
+// ϸ (߸ ) game  Ϻθ ٲ  ִ
+inline bool restoreSnapshot(Game& game, const std::vector<uint8_t>& snapshot) {
+    SnapshotReader reader(snapshot.data(), snapshot.size());
+    game.serialize(reader);
+    game.hits.clear();
+    return reader.finished();
+}
+
+namespace snapshot_delta {
+
+//  κ 4Ʈ (float, int) 迭̹Ƿ 4Ʈ  Ѵ.
+// ̺ ª   ǳʶ ʰ ״ ´ ( Ӹ  ũ).
+const size_t WORD = 4;
+const size_t MIN_SAME_WORDS = 2;
+
+inline void putVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back((uint8_t)((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.push_back((uint8_t)v);
+}
+
+inline bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        uint8_t c = *p++;
+        v |= (uint64_t)(c & 0x7f) << shift;
+        if (!(c & 0x80)) return true;
+    }
+    return false;
+}
+
+inline bool sameWord(const uint8_t* a, const uint8_t* b) {
+    uint32_t x, y;
+    std::memcpy(&x, a, WORD);
+    std::memcpy(&y, b, WORD);
+    return x == y;
+}
+
+inline uint64_t xorLong(const uint8_t* a, const uint8_t* b) {
+    uint64_t x, y;
+    std::memcpy(&x, a, 8);
+    std::memcpy(&y, b, 8);
+    return x ^ y;
+}
+
+// out[k] = a[k] ^ b[k] (8Ʈ)
+inline void xorBytes(uint8_t* out, const uint8_t* a, const uint8_t* b, size_t n) {
+    size_t k = 0;
+    for (; k + 8 <= n; k += 8) {
+        uint64_t x = xorLong(a + k, b + k);
+        std::memcpy(out + k, &x, 8);
+    }
+    for (; k < n; k++) out[k] = a[k] ^ b[k];
+}
+
+} // namespace snapshot_delta
+
+// base  target   ̸ out  
+// : varint target ũ,  ڷ (varint  Ʈ , varint ٸ Ʈ , ٸ Ʈ XOR base) ݺ.
+// 񱳴 4Ʈ ̰, base   κа 4Ʈ  Ǵ  ° ٸ Ʈ ´.
+inline void encodeDelta(const std::vector<uint8_t>& base, const std::vector<uint8_t>& target, std::vector<uint8_t>& out) {
+    using namespace snapshot_delta;
+    out.clear();
+    const uint8_t* t = target.data();
+    const uint8_t* b = base.data();
+    size_t n = target.size();
+    size_t words = std::min(base.size(), n) / WORD * WORD; //    ִ պκ
+    putVarint(out, n);
+
+    size_t i = 0;
+    while (i < n) {
+        //   (8Ʈ  ǳʶڴ)
+        size_t start = i;
+        while (i + 8 <= words && xorLong(t + i, b + i) == 0) i += 8;
+        while (i < words && sameWord(t + i, b + i)) i += WORD;
+        size_t same = i - start;
+
+        // ٸ :   MIN_SAME_WORDS  ̾ ,     
+        size_t literal = i;
+        size_t end = i;
+        size_t run = 0;
+        while (end < words) {
+            // 8Ʈ     ٸ   Ѿ
+            if (end + 8 <= words) {
+                uint64_t d = xorLong(t + end, b + end);
+                if ((uint32_t)d != 0 && (d >> 32) != 0) {
+                    run = 0;
+                    end += 8;
+                    continue;
+                }
+            }
+            if (sameWord(t + end, b + end)) {
+                if (++run == MIN_SAME_WORDS) {
+                    end -= (MIN_SAME_WORDS - 1) * WORD;
+                    break;
+                }
+            }
+            else {
+                run = 0;
+            }
+            end += WORD;
+        }
+        if (end >= words) end = n;
+
+        putVarint(out, same);
+        putVarint(out, end - literal);
+        size_t at = out.size();
+        out.resize(at + (end - literal));
+        uint8_t* o = out.data() + at - literal;
+        size_t xorEnd = std::min(end, base.size());
+        if (xorEnd > literal) xorBytes(o + literal, t + literal, b + literal, xorEnd - literal);
+        for (size_t k = std::max(literal, xorEnd); k < end; k++) o[k] = t[k];
+        i = end;
+    }
+}
+
+// base  encodeDelta   target  ٽ  (out  base  ٸ ۿ Ѵ)
+inline bool decodeDelta(const std::vector<uint8_t>& base, const std::vector<uint8_t>& delta, std::vector<uint8_t>& out) {
+    using namespace snapshot_delta;
+    const uint8_t* p = delta.data();
+    const uint8_t* end = p + delta.size();
+    uint64_t n;
+    if (!getVarint(p, end, n)) return false;
+
+    out.resize((size_t)n);
+    size_t common = std::min(base.size(), (size_t)n);
+    if (common) std::memcpy(out.data(), base.data(), common);
+    if (n > common) std::memset(out.data() + common, 0, (size_t)n - common);
+
+    size_t i = 0;
+    while (i < n) {
+        uint64_t same, literal;
+        if (!getVarint(p, end, same) || !getVarint(p, end, literal)) return false;
+        if (same > n - i || literal > n - i - same || literal > (uint64_t)(end - p)) return false;
+        i += (size_t)same;
+        uint8_t* o = out.data() + i;
+        xorBytes(o, o, p, (size_t)literal);
+        p += literal;
+        i += (size_t)literal;
+    }
+    return p == end;
+}
+
+// ֱ ƽ  (ѹ)
+class RollbackHistory {
+public:
+    explicit RollbackHistory(int capacity = 120)
+        : deltas(std::max(1, capacity)), newest(0), hasNewest(false), count(0), deltaBytes(0) {}
+
+    void clear() {
+        hasNewest = false;
+        count = 0;
+    }
+
+    // tick  ¸  (  ƽ update ).   ƽ  ƽ ƴϸ   .
+    void save(const Game& game, uint64_t tick) {
+        captureSnapshot(game, scratch);
+        if (hasNewest && tick == newest + 1) {
+            //  ¿  ·  
+            std::vector<uint8_t>& delta = deltas[newest % deltas.size()];
+            encodeDelta(scratch, latest, delta);
+            deltaBytes = delta.size();
+            count = std::min(count + 1, (int)deltas.size());
+        }
+        else {
+            count = 0;
+        }
+        latest.swap(scratch);
+        newest = tick;
+        hasNewest = true;
+    }
+
+    bool has(uint64_t tick) const {
+        return hasNewest && tick <= newest && newest - tick <= (uint64_t)count;
+    }
+
+    uint64_t newestTick() const { return newest; }
+    uint64_t oldestTick() const { return newest - count; }
+    size_t snapshotBytes() const { return latest.size(); }
+    size_t lastDeltaBytes() const { return deltaBytes; }
+
+    // game  tick  · ǵ, ׺   
+    bool rollback(Game& game, uint64_t tick) {
+        if (!has(tick)) return false;
+
+        current.assign(latest.begin(), latest.end());
+        for (uint64_t t = newest; t > tick; t--) {
+            if (!decodeDelta(current, deltas[(t - 1) % deltas.size()], scratch)) return false;
+            current.swap(scratch);
+        }
+        if (!restoreSnapshot(game, current)) return false;
+
+        latest.swap(current);
+        count -= (int)(newest - tick);
+        newest = tick;
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> latest;               // newest ƽ 
+    std::vector<std::vector<uint8_t>> deltas;  // [t % 뷮]: t+1  ¿ t  ·  
+    std::vector<uint8_t> scratch, current;
+    uint64_t newest;
+    bool hasNewest;
+    int count; // ǵ  ִ  ƽ 
+    size_t deltaBytes;
+};
+
+// tick  ǵ   ƽ ٽ Ѵ (ʰ  Է ݿ ).
+// step(t)  t ƽ ¿  ƽ ؾ Ѵ (Է ְ update). ٽ  ƽ ϵȴ.
+template <typename Step>
+bool resimulate(Game& game, RollbackHistory& history, uint64_t tick, Step step) {
+    uint64_t target = history.newestTick();
+    if (!history.rollback(game, tick)) return false;
+    for (uint64_t t = tick; t < target; t++) {
+        step(t);
+        history.save(game, t + 1);
+    }
+    return true;
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include "shader.h"
+#include "stream_buffer.h"
+
+// νϽ ϳ ʿ  (ġ, ũ, ȸ, )
+struct SpriteInstance {
+    float x, y;
+    float scale;
+    float rotation;
+    float r, g, b;
+};
+
+// /Ѿ//Ҳ ġ 
+// ۿ  νϽ  draw()   ޽ø glDrawArraysInstanced   ׸.
+// ǥ draw  𵨺  ̴.
+class SpriteBatch {
+public:
+    enum Mesh { MESH_STAR, MESH_BULLET, MESH_CIRCLE, MESH_SPARK, MESH_COUNT }; // ׸  (  ߽ ,   ƼŬ)
+
+    SpriteBatch() : program(0), instanceVBO(0), supported(false) {
+        for (int i = 0; i < MESH_COUNT; i++) {
+            meshes[i].vbo = 0;
+            meshes[i].vertexCount = 0;
+        }
+    }
+
+    //   VBO(ﰢ ) ״ ޽÷ 
+    void init(GLuint circleVBO, int circleVertices, GLuint bulletVBO, int bulletVertices,
+        GLuint starVBO, int starVertices, GLuint sparkVBO, int sparkVertices) {
+        meshes[MESH_CIRCLE].vbo = circleVBO;
+        meshes[MESH_CIRCLE].vertexCount = circleVertices;
+        meshes[MESH_BULLET].vbo = bulletVBO;
+        meshes[MESH_BULLET].vertexCount = bulletVertices;
+        meshes[MESH_STAR].vbo = starVBO;
+        meshes[MESH_STAR].vertexCount = starVertices;
+        meshes[MESH_SPARK].vbo = sparkVBO;
+        meshes[MESH_SPARK].vertexCount = sparkVertices;
+
+        supported = GLEW_VERSION_3_3 && createProgram();
+        if (supported) {
+            glGenBuffers(1, &instanceVBO);
+            stream.init(STREAM_SEGMENT_BYTES);
+        }
+        else {
+            std::cerr << "νϽ :   ׸ϴ" << std::endl;
+        }
+    }
+
+    void cleanup() {
+        stream.cleanup();
+        if (instanceVBO) glDeleteBuffers(1, &instanceVBO);
+        if (program) glDeleteProgram(program);
+        instanceVBO = 0;
+        program = 0;
+    }
+
+    // false   νϽ  ׸
+    bool instanced() const { return supported; }
+
+    // Ӹ  : νϽ     Ѿ
+    void nextFrame() {
+        stream.nextFrame();
+    }
+
+    // νϽ  ٷ ׸ (LegacyRenderer)
+    void draw(Mesh mesh, const std::vector<SpriteInstance>& list) {
+        if (list.empty()) return;
+        if (supported) {
+            drawInstanced(meshes[mesh], list);
+        }
+        else {
+            drawFixedFunction(meshes[mesh], list);
+        }
+    }
+
+private:
+    struct MeshInfo {
+        GLuint vbo;
+        int vertexCount;
+    };
+
+    //  Ӽ ġ
+    enum { ATTRIB_POSITION = 0, ATTRIB_TRANSFORM = 1, ATTRIB_COLOR = 2 };
+
+    static const GLsizeiptr STREAM_SEGMENT_BYTES = 1 << 20;
+
+    MeshInfo meshes[MESH_COUNT];
+    GLuint program;
+    GLuint instanceVBO;
+    StreamBuffer stream;
+    bool supported;
+
+    void drawInstanced(const MeshInfo& mesh, const std::vector<SpriteInstance>& list) {
+        glUseProgram(program);
+
+        //  ۿ ڸ  ε ޸𸮿 ٷ ϰ,
+        //    д   Ƿ  Ҹ ޾(ȭ) ø
+        GLsizeiptr bytes = list.size() * sizeof(SpriteInstance);
+        GLintptr offset = 0;
+        void* dst = stream.allocate(bytes, offset);
+        if (dst) {
+            memcpy(dst, list.data(), bytes);
+            glBindBuffer(GL_ARRAY_BUFFER, stream.buffer());
+        }
+        else {
+            glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+            glBufferData(GL_ARRAY_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, list.data());
+        }
+
+        glEnableVertexAttribArray(ATTRIB_TRANSFORM);
+        glVertexAttribPointer(ATTRIB_TRANSFORM, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance), (void*)offset);
+        glVertexAttribDivisor(ATTRIB_TRANSFORM, 1);
+        glEnableVertexAttribArray(ATTRIB_COLOR);
+        glVertexAttribPointer(ATTRIB_COLOR, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+            (void*)(offset + 4 * sizeof(float)));
+        glVertexAttribDivisor(ATTRIB_COLOR, 1);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+        glEnableVertexAttribArray(ATTRIB_POSITION);
+        glVertexAttribPointer(ATTRIB_POSITION, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+        glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, mesh.vertexCount, (GLsizei)list.size());
+
+        glVertexAttribDivisor(ATTRIB_TRANSFORM, 0);
+        glVertexAttribDivisor(ATTRIB_COLOR, 0);
+        glDisableVertexAttribArray(ATTRIB_POSITION);
+        glDisableVertexAttribArray(ATTRIB_TRANSFORM);
+        glDisableVertexAttribArray(ATTRIB_COLOR);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glUseProgram(0);
+    }
+
+    // νϽ    : νϽ  ٲ ׸
+    void drawFixedFunction(const MeshInfo& mesh, const std::vector<SpriteInstance>& list) {
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(2, GL_FLOAT, 0, 0);
+        for (const SpriteInstance& inst : list) {
+            glColor3f(inst.r, inst.g, inst.b);
+            glPushMatrix();
+            glTranslatef(inst.x, inst.y, 0);
+            glRotatef(inst.rotation * 180.0f / 3.14159265f, 0, 0, 1);
+            glScalef(inst.scale, inst.scale, 1);
+            glDrawArrays(GL_TRIANGLE_FAN, 0, mesh.vertexCount);
+            glPopMatrix();
+        }
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    bool createProgram() {
+        // ȣȯ :    (glOrtho, ī޶ 鸲) ״ 
+        const char* vertexSource =
+            "#version 120\n"
+            "attribute vec2 aPosition;\n"
+            "attribute vec4 aTransform;\n" // x, y, scale, rotation
+            "attribute vec3 aColor;\n"
+            "varying vec3 vColor;\n"
+            "void main() {\n"
+            "    float c = cos(aTransform.w);\n"
+            "    float s = sin(aTransform.w);\n"
+            "    vec2 p = aPosition * aTransform.z;\n"
+            "    p = vec2(c * p.x - s * p.y, s * p.x + c * p.y) + aTransform.xy;\n"
+            "    gl_Position = gl_ModelViewProjectionMatrix * vec4(p, 0.0, 1.0);\n"
+            "    vColor = aColor;\n"
+            "}\n";
+        const char* fragmentSource =
+            "#version 120\n"
+            "varying vec3 vColor;\n"
+            "void main() {\n"
+            "    gl_FragColor = vec4(vColor, 1.0);\n"
+            "}\n";
+
+        // ATTRIB_*  ƾ Ѵ
+        const char* attribs[] = { "aPosition", "aTransform", "aColor" };
+        program = linkProgram(vertexSource, fragmentSource, attribs, 3);
+        return program != 0;
+    }
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <cstring>
+
+// Ӹ  ä /νϽ Ϳ Ʈ 
+// GL_ARB_buffer_storage   ۸       (persistent + coherent) ΰ,
+// Ӹ   ̾ .  ٽ       
+// 潺 ٸǷ ̹  ʰ, ε ޸𸮿 ٷ  絵   پ.
+// Ȯ  persistent()  false ̰ allocate  ׻ nullptr  ش (ȣ  ȭ ø).
+//
+//   stream.nextFrame();                       //  
+//   GLintptr offset;
+//   void* dst = stream.allocate(bytes, offset);
+//   if (dst) { ...dst ...; glVertexAttribPointer(..., (void*)offset); }
+class StreamBuffer {
+public:
+    static const int SEGMENTS = 3; // Ʈ ۸
+
+    StreamBuffer() : vbo(0), mapped(nullptr), segmentBytes(0), segment(0), used(0), demand(0), started(false) {
+        for (int i = 0; i < SEGMENTS; i++) fences[i] = 0;
+    }
+
+    // segmentSize:  ӿ   ϴ Ʈ  (ڶ  ӿ ø)
+    bool init(GLsizeiptr segmentSize) {
+        if (!(GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage)) return false;
+        return create(segmentSize);
+    }
+
+    void cleanup() {
+        waitAll();
+        destroy();
+        segmentBytes = 0;
+        used = demand = 0;
+        started = false;
+    }
+
+    bool persistent() const { return mapped != nullptr; }
+    GLuint buffer() const { return vbo; }
+
+    //    潺 ɰ   Ѿ
+    void nextFrame() {
+        if (!mapped) return;
+        if (started) {
+            fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            segment = (segment + 1) % SEGMENTS;
+        }
+        started = true;
+
+        //  ӿ ڸ ڶ ⼭(׸    ) û ѷ   ø
+        if (demand > segmentBytes) {
+            GLsizeiptr size = segmentBytes;
+            while (size < demand) size *= 2;
+            waitAll();
+            destroy();
+            if (!create(size)) return;
+        }
+        wait(segment);
+        used = 0;
+        demand = 0;
+    }
+
+    //   bytesŭ ߶  ͸ ش. offset  ۺ ġ.
+    // ڸ  nullptr (̹  ȣ  ٸ η ø,  Ӻ þ)
+    void* allocate(GLsizeiptr bytes, GLintptr& offset) {
+        GLsizeiptr start = (used + ALIGNMENT - 1) & ~(GLsizeiptr)(ALIGNMENT - 1);
+        demand += (bytes + ALIGNMENT - 1) & ~(GLsizeiptr)(ALIGNMENT - 1); //  û 
+        if (!mapped || start + bytes > segmentBytes) return nullptr;
+
+        used = start + bytes;
+        offset = segment * segmentBytes + start;
+        return (char*)mapped + offset;
+    }
+
+private:
+    static const GLsizeiptr ALIGNMENT = 64;
+
+    GLuint vbo;
+    void* mapped;
+    GLsizeiptr segmentBytes;
+    int segment;
+    GLsizeiptr used;  //    Ʈ
+    GLsizeiptr demand; // ̹ ӿ û Ʈ  ( , ڸ   ͱ)
+    bool started;
+    GLsync fences[SEGMENTS];
+
+    bool create(GLsizeiptr size) {
+        size = (size + ALIGNMENT - 1) & ~(GLsizeiptr)(ALIGNMENT - 1);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferStorage(GL_ARRAY_BUFFER, size * SEGMENTS, nullptr, flags);
+        mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, size * SEGMENTS, flags);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (!mapped) {
+            destroy();
+            return false;
+        }
+        segmentBytes = size;
+        segment = 0;
+        used = 0;
+        return true;
+    }
+
+    void destroy() {
+        if (vbo) {
+            if (mapped) {
+                glBindBuffer(GL_ARRAY_BUFFER, vbo);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+            }
+            glDeleteBuffers(1, &vbo);
+        }
+        vbo = 0;
+        mapped = nullptr;
+    }
+
+    void wait(int i) {
+        if (!fences[i]) return;
+        // ó    о ְ ٸ (1ms)
+        GLenum result = glClientWaitSync(fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(fences[i], 0, 1000000);
+        }
+        glDeleteSync(fences[i]);
+        fences[i] = 0;
+    }
+
+    void waitAll() {
+        for (int i = 0; i < SEGMENTS; i++) wait(i);
+    }
+};